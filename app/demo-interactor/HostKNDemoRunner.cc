@@ -8,12 +8,18 @@
 #include "HostKNDemoRunner.hh"
 
 #include <iostream>
-#include <random>
+#include <memory>
+#include <vector>
+#include "base/ScopedTimer.hh"
 #include "base/Stopwatch.hh"
 #include "base/Range.hh"
 #include "base/ArrayUtils.hh"
 #include "random/distributions/ExponentialDistribution.hh"
+#include "random/CountingRngEngine.hh"
+#include "random/philox/PhiloxEngine.hh"
+#include "physics/base/ParticleStateStore.hh"
 #include "physics/base/ParticleTrackView.hh"
+#include "physics/base/RngDrawProfiler.hh"
 #include "physics/base/Units.hh"
 #include "physics/base/Secondary.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
@@ -33,19 +39,28 @@ namespace demo_interactor
  * Construct with parameters.
  */
 HostKNDemoRunner::HostKNDemoRunner(constSPParticleParams particles,
-                                   constSPXsGridParams   xs)
-    : pparams_(std::move(particles)), xsparams_(std::move(xs))
+                                   constSPXsGridParams   xs,
+                                   SPThreadPool          pool)
+    : pparams_(std::move(particles))
+    , xsparams_(std::move(xs))
+    , pool_(std::move(pool))
 {
     CELER_EXPECT(pparams_);
     CELER_EXPECT(xsparams_);
+    CELER_EXPECT(pool_);
 
     // Set up KN interactor data;
     namespace pdg            = celeritas::pdg;
+    kn_pointers_.model_id    = ModelId{0}; // Unused but needed for error check
     kn_pointers_.electron_id = pparams_->find(pdg::electron());
     kn_pointers_.gamma_id    = pparams_->find(pdg::gamma());
     kn_pointers_.inv_electron_mass
         = 1 / pparams_->get(kn_pointers_.electron_id).mass.value();
     CELER_ENSURE(kn_pointers_);
+
+#if CELERITAS_PROFILE_RNG
+    rng_profile_ = RngDrawProfileStore(1, 64, MemSpace::host);
+#endif
 }
 
 //---------------------------------------------------------------------------//
@@ -66,10 +81,6 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
 
     // Start timer for overall execution and transport-only time
     Stopwatch total_time;
-    double    transport_time = 0.0;
-
-    // Random number generations
-    std::mt19937 rng(args.seed);
 
     // Particle param pointers
     auto pp_host_ptrs = pparams_->host_pointers();
@@ -78,46 +89,79 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
     auto                   xs_host_ptrs = xsparams_->host_pointers();
     PhysicsGridCalculator  calc_xs(xs_host_ptrs);
 
-    // Make secondary store
-    HostStackAllocatorStore<Secondary> secondaries(args.max_steps);
-    auto secondary_host_ptrs = secondaries.host_pointers();
+    // Random draw histograms, if enabled
+    RngDrawProfilePointers rng_profile;
+    if (rng_profile_.num_models() > 0)
+    {
+        rng_profile_.clear();
+        rng_profile = rng_profile_.device_pointers();
+    }
 
-    // Make detector store
-    HostDetectorStore detector(args.max_steps, args.tally_grid);
-    auto              detector_host_ptrs = detector.host_pointers();
+    // Counter-based random number key
+    const PhiloxKey rng_key = make_philox_key(args.seed);
+
+    // Make secondary and detector stores for each thread
+    struct ThreadStorage
+    {
+        ThreadStorage(const KNDemoRunArgs& args)
+            : particle(1, MemSpace::host)
+            , secondaries(args.max_steps)
+            , detector(args.max_steps, args.tally_grid)
+        {
+        }
 
-    // Loop over particle tracks and events per track
-    for (CELER_MAYBE_UNUSED auto n : celeritas::range(args.num_tracks))
+        ParticleStateStore                 particle;
+        HostStackAllocatorStore<Secondary> secondaries;
+        HostDetectorStore                  detector;
+    };
+    std::vector<std::unique_ptr<ThreadStorage>> thread_storage;
+    for (CELER_MAYBE_UNUSED auto i : celeritas::range(pool_->num_threads()))
     {
+        thread_storage.push_back(std::make_unique<ThreadStorage>(args));
+    }
+
+    // Transport a single track using the storage for the current thread
+    auto transport_track = [&](size_type n) {
+        ScopedTimer time_track("transport_track");
+
+        ThreadStorage& storage = *thread_storage[ThreadPool::worker_index()];
+        auto& secondaries = storage.secondaries;
+        auto& detector    = storage.detector;
+
         // Place cap on maximum number of steps
         auto remaining_steps = args.max_steps;
 
-        // Make the initial track state
-        celeritas::ParticleTrackState init_state = {
-            kn_pointers_.gamma_id, celeritas::units::MevEnergy(args.energy)};
-
         // Initialize particle state
         StatePointers state;
-        state.particle.vars = {&init_state, 1};
-        state.position      = {0, 0, 0};
-        state.direction     = {0, 0, 1};
-        state.time          = 0;
-        state.alive         = true;
+        {
+            ScopedTimer time_init("initialize");
+            state.particle  = storage.particle.device_pointers();
+            state.position  = {0, 0, 0};
+            state.direction = {0, 0, 1};
+            state.time      = 0;
+            state.alive     = true;
+            ParticleTrackView(pp_host_ptrs, state.particle, ThreadId(0)) = {
+                kn_pointers_.gamma_id, celeritas::units::MevEnergy(args.energy)};
+        }
 
         // Secondary pointers
-        SecondaryAllocatorView allocate_secondaries(secondary_host_ptrs);
+        SecondaryAllocatorView allocate_secondaries(
+            secondaries.host_pointers());
         CELER_ASSERT(secondaries.capacity() == args.max_steps);
         CELER_ASSERT(allocate_secondaries.get().size() == 0);
 
         // Detector hits
-        DetectorView detector_hit(detector_host_ptrs);
+        DetectorView detector_hit(detector.host_pointers());
 
         // Step counter
-        CELER_MAYBE_UNUSED size_type num_steps = 0;
+        size_type num_steps = 0;
 
-        Stopwatch elapsed_time;
         while (state.alive && --remaining_steps > 0)
         {
+            // Random number stream for this step of the track: independent
+            // of thread scheduling
+            PhiloxEngine rng(rng_key, EventId{0}, TrackId(n), num_steps);
+
             // Get a particle track view to a single particle
             auto particle
                 = ParticleTrackView(pp_host_ptrs, state.particle, ThreadId(0));
@@ -125,7 +169,8 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
             // Move to collision
             {
                 real_type sigma = calc_xs(particle.energy());
-                ExponentialDistribution<real_type> sample_distance(sigma);
+                ExponentialDistribution<real_type, SamplingMethod::ziggurat>
+                    sample_distance(sigma);
                 real_type distance = sample_distance(rng);
                 celeritas::axpy(distance, state.direction, &state.position);
                 state.time += distance * celeritas::unit_cast(particle.speed());
@@ -137,7 +182,7 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
             // Hit analysis
             Hit h;
             h.pos    = state.position;
-            h.thread = ThreadId(0);
+            h.thread = ThreadId(n);
             h.time   = state.time;
 
             // Check for below energy cutoff
@@ -153,12 +198,24 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
                 continue;
             }
 
-            // Construct the KN interactor
-            KleinNishinaInteractor interact(
-                kn_pointers_, particle, state.direction, allocate_secondaries);
-
-            // Perform interactions - emits a single particle
-            auto interaction = interact(rng);
+            // Construct the KN interactor and perform interactions - emits a
+            // single particle
+            Interaction interaction;
+            {
+                ScopedTimer time_interact("KleinNishinaModel::interact");
+                KleinNishinaInteractor interact(kn_pointers_,
+                                                particle,
+                                                state.direction,
+                                                allocate_secondaries);
+#if CELERITAS_PROFILE_RNG
+                CountingRngEngine<PhiloxEngine> counted_rng(rng);
+                interaction = interact(counted_rng);
+                RngDrawProfiler record_draws(rng_profile);
+                record_draws(kn_pointers_.model_id, counted_rng.count());
+#else
+                interaction = interact(rng);
+#endif
+            }
             CELER_ASSERT(interaction);
             CELER_ASSERT(interaction.secondaries.size() == 1);
 
@@ -187,19 +244,38 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
                 .size()
             == num_steps);
 
-        // Store transport time
-        transport_time += elapsed_time();
-
         // Clear secondaries
         secondaries.clear();
         CELER_ASSERT(secondaries.get_size() == 0);
 
         // Bin the tally results from the buffer onto the grid
+        ScopedTimer time_tally("bin_buffer");
         detector.bin_buffer();
-    }
+    };
 
-    // Copy integrated energy deposition
-    result.edep = detector.finalize(1 / real_type(args.num_tracks));
+    // Loop over particle tracks, one track per task
+    Stopwatch elapsed_time;
+    scheduler_stats_ = pool_->parallel_for(
+        args.num_tracks, 1, [&transport_track](size_type begin, size_type end) {
+            for (auto n : celeritas::range(begin, end))
+            {
+                transport_track(n);
+            }
+        });
+    double transport_time = elapsed_time();
+
+    // Sum integrated energy deposition over threads
+    const real_type norm = 1 / real_type(args.num_tracks);
+    result.edep          = {};
+    for (auto& storage : thread_storage)
+    {
+        auto edep = storage->detector.finalize(norm);
+        result.edep.resize(edep.size(), 0.0);
+        for (auto i : celeritas::range(edep.size()))
+        {
+            result.edep[i] += edep[i];
+        }
+    }
 
     // Store timings
     result.time.push_back(transport_time);
@@ -7,8 +7,11 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
+#include "base/ThreadPool.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/ParticleStatePointers.hh"
+#include "physics/base/RngDrawProfileStore.hh"
 #include "physics/em/detail/KleinNishina.hh"
 #include "KNDemoIO.hh"
 #include "XsGridParams.hh"
@@ -20,7 +23,9 @@ namespace demo_interactor
  * Run interactions on the host CPU.
  *
  * This is an analog to the demo_interactor::KNDemoRunner for device simulation
- * but does all the transport directly on the CPU side.
+ * but does all the transport directly on the CPU side. Tracks are transported
+ * independently on the threads of a work-stealing \c ThreadPool, each of
+ * which has its own secondary and hit buffers.
  */
 class HostKNDemoRunner
 {
@@ -32,6 +37,8 @@ class HostKNDemoRunner
     using constSPParticleParams
         = std::shared_ptr<const celeritas::ParticleParams>;
     using constSPXsGridParams = std::shared_ptr<const XsGridParams>;
+    using SPThreadPool        = std::shared_ptr<celeritas::ThreadPool>;
+    using SchedulerStats      = celeritas::ThreadPool::Stats;
     //!@}
 
   private:
@@ -47,15 +54,32 @@ class HostKNDemoRunner
 
   public:
     // Construct with parameters
-    HostKNDemoRunner(constSPParticleParams particles, constSPXsGridParams xs);
+    HostKNDemoRunner(constSPParticleParams particles,
+                     constSPXsGridParams   xs,
+                     SPThreadPool          pool = celeritas::ThreadPool::global());
 
     // Run given number of particles
     result_type operator()(demo_interactor::KNDemoRunArgs args);
 
+    //! Scheduling statistics from the last run
+    const SchedulerStats& scheduler_stats() const { return scheduler_stats_; }
+
+    //! Thread pool used for transport
+    const SPThreadPool& pool() const { return pool_; }
+
+    //! Random draws per interaction (only filled with CELERITAS_PROFILE_RNG)
+    const celeritas::RngDrawProfileStore& rng_profile() const
+    {
+        return rng_profile_;
+    }
+
   private:
     constSPParticleParams                     pparams_;
     constSPXsGridParams                       xsparams_;
+    SPThreadPool                              pool_;
     celeritas::detail::KleinNishinaPointers   kn_pointers_;
+    SchedulerStats                            scheduler_stats_;
+    celeritas::RngDrawProfileStore            rng_profile_;
 };
 
 //---------------------------------------------------------------------------//
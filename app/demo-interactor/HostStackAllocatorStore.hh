@@ -31,10 +31,11 @@ class HostStackAllocatorStore
   public:
     // Construct with defaults
     explicit HostStackAllocatorStore(size_type capacity)
-        : storage_(capacity), size_(0)
+        : storage_(capacity), size_(0), overflow_(0)
     {
-        pointers_.storage = make_span(storage_);
-        pointers_.size    = &size_;
+        pointers_.storage  = make_span(storage_);
+        pointers_.size     = &size_;
+        pointers_.overflow = &overflow_;
     }
 
     //! Size of the allocation
@@ -43,8 +44,15 @@ class HostStackAllocatorStore
     //! Get the current size
     size_type get_size() { return size_; }
 
+    //! Get the number of values that failed to allocate
+    size_type get_overflow() { return overflow_; }
+
     //! Clear allocated data (as for StackAllocator, just sets size to 0)
-    void clear() { size_ = 0; }
+    void clear()
+    {
+        size_     = 0;
+        overflow_ = 0;
+    }
 
     //// HOST ACCESSORS ////
 
@@ -54,6 +62,7 @@ class HostStackAllocatorStore
   private:
     std::vector<value_type> storage_;
     size_type               size_;
+    size_type               overflow_;
     Pointers                pointers_;
 };
 
@@ -8,6 +8,7 @@
 #include "KNDemoRunner.hh"
 
 #include "base/Range.hh"
+#include "base/ScopedDeviceTimer.hh"
 #include "base/Stopwatch.hh"
 #include "random/cuda/RngStateStore.hh"
 #include "physics/base/ParticleStateStore.hh"
@@ -92,7 +93,10 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
     state.alive     = alive.device_pointers();
 
     // Initialize particle states
-    initialize(launch_params_, params, state, initial);
+    {
+        ScopedDeviceTimer time_init("initialize");
+        initialize(launch_params_, params, state, initial);
+    }
     result.alive.push_back(args.num_tracks);
 
     size_type remaining_steps = args.max_steps;
@@ -100,11 +104,14 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
     {
         // Launch the kernel
         Stopwatch elapsed_time;
-        iterate(launch_params_,
-                params,
-                state,
-                secondaries.device_pointers(),
-                detector.device_pointers());
+        {
+            ScopedDeviceTimer time_iterate("iterate");
+            iterate(launch_params_,
+                    params,
+                    state,
+                    secondaries.device_pointers(),
+                    detector.device_pointers());
+        }
 
         // Save the wall time
         result.time.push_back(elapsed_time());
@@ -114,7 +121,10 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
         secondaries.clear();
 
         // Bin detector depositions from the buffer into the grid
-        detector.bin_buffer();
+        {
+            ScopedDeviceTimer time_tally("bin_buffer");
+            detector.bin_buffer();
+        }
 
         // Calculate and save number of living particles
         result.alive.push_back(reduce_alive(alive.device_pointers()));
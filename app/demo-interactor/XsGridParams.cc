@@ -20,12 +20,6 @@ namespace demo_interactor
  * Construct with input data.
  */
 XsGridParams::XsGridParams(const Input& input)
-    : xs_(input.xs.size())
-    , prime_index_(std::find(input.energy.begin(),
-                             input.energy.end(),
-                             input.prime_energy)
-                   - input.energy.begin())
-    , host_xs_(input.xs)
 {
     CELER_EXPECT(input.energy.size() >= 2);
     CELER_EXPECT(input.energy.front() > 0);
@@ -33,10 +27,14 @@ XsGridParams::XsGridParams(const Input& input)
     CELER_EXPECT(input.xs.size() == input.energy.size());
     CELER_EXPECT(std::all_of(
         input.xs.begin(), input.xs.end(), [](real_type v) { return v >= 0; }));
-    CELER_EXPECT(prime_index_ != input.energy.size());
+    celeritas::size_type prime_index
+        = std::find(
+              input.energy.begin(), input.energy.end(), input.prime_energy)
+          - input.energy.begin();
+    CELER_EXPECT(prime_index != input.energy.size());
 
     // Calculate uniform-in-logspace energy grid
-    log_energy_ = celeritas::UniformGridPointers::from_bounds(
+    auto log_energy = celeritas::UniformGridPointers::from_bounds(
         std::log(input.energy.front()),
         std::log(input.energy.back()),
         input.energy.size());
@@ -46,17 +44,21 @@ XsGridParams::XsGridParams(const Input& input)
         // Test soft equivalence between log energy grid and input energy to
         // make sure all the points are uniformly spaced
         celeritas::SoftEqual<> soft_eq(1e-8);
-        celeritas::UniformGrid log_energy(log_energy_);
-        CELER_ASSERT(log_energy.size() == input.energy.size());
+        celeritas::UniformGrid loge_grid(log_energy);
+        CELER_ASSERT(loge_grid.size() == input.energy.size());
         for (auto i : celeritas::range(input.energy.size()))
         {
-            CELER_EXPECT(soft_eq(std::log(input.energy[i]), log_energy[i]));
+            CELER_EXPECT(soft_eq(std::log(input.energy[i]), loge_grid[i]));
         }
     }
 #endif
 
-    // Copy xs values to device
-    xs_.copy_to_device(celeritas::make_span(input.xs));
+    // Pack xs values and copy to device
+    grid_id_ = store_.push_back(celeritas::ValueGridType::macro_xs,
+                                log_energy,
+                                prime_index,
+                                celeritas::make_span(input.xs));
+    store_.copy_to_device();
 }
 
 //---------------------------------------------------------------------------//
@@ -65,11 +67,7 @@ XsGridParams::XsGridParams(const Input& input)
  */
 auto XsGridParams::device_pointers() const -> XsGridPointers
 {
-    XsGridPointers result;
-    result.log_energy  = log_energy_;
-    result.prime_index = prime_index_;
-    result.value       = xs_.device_pointers();
-    return result;
+    return store_.device_pointers(grid_id_);
 }
 
 //---------------------------------------------------------------------------//
@@ -78,12 +76,7 @@ auto XsGridParams::device_pointers() const -> XsGridPointers
  */
 auto XsGridParams::host_pointers() const -> XsGridPointers
 {
-    XsGridPointers result;
-    result.log_energy  = log_energy_;
-    result.prime_index = prime_index_;
-    result.value       = celeritas::make_span(host_xs_);
-
-    return result;
+    return store_.host_pointers(grid_id_);
 }
 
 //---------------------------------------------------------------------------//
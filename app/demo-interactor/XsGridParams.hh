@@ -8,8 +8,7 @@
 #pragma once
 
 #include <vector>
-#include "base/DeviceVector.hh"
-#include "physics/grid/XsGridPointers.hh"
+#include "physics/grid/ValueGridStore.hh"
 
 namespace demo_interactor
 {
@@ -49,12 +48,8 @@ class XsGridParams
     XsGridPointers host_pointers() const;
 
   private:
-    celeritas::UniformGridPointers     log_energy_;
-    celeritas::DeviceVector<real_type> xs_;
-    celeritas::size_type               prime_index_;
-
-    // Host side xs data
-    std::vector<real_type> host_xs_;
+    celeritas::ValueGridStore store_;
+    celeritas::ValueGridId    grid_id_;
 };
 
 //---------------------------------------------------------------------------//
@@ -10,13 +10,16 @@
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include "comm/Communicator.hh"
 #include "comm/Logger.hh"
 #include "comm/ScopedMpiInit.hh"
+#include "base/TimerRegistry.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/base/RngDrawProfileStore.hh"
 #include "LoadXs.hh"
 #include "KNDemoIO.hh"
 #include "HostKNDemoRunner.hh"
@@ -67,10 +70,32 @@ void run(std::istream& is)
     CELER_EXPECT(run_args.max_steps > 0);
     auto result = run(run_args);
 
-    nlohmann::json outp = {
+    // Hierarchical timing results
+    std::ostringstream timers;
+    TimerRegistry::global().write_json(timers);
+
+    const auto&    sched = run.scheduler_stats();
+    nlohmann::json outp  = {
         {"run", run_args},
         {"result", result},
+        {"scheduler",
+         {
+             {"num_threads", run.pool()->num_threads()},
+             {"num_tasks", sched.num_tasks},
+             {"num_splits", sched.num_splits},
+             {"num_steals", sched.num_steals},
+             {"num_failed_steals", sched.num_failed_steals},
+             {"idle_time", sched.idle_time},
+         }},
+        {"timers", nlohmann::json::parse(timers.str())},
     };
+    if (run.rng_profile().num_models() > 0)
+    {
+        // Random draws per interaction
+        std::ostringstream rng_draws;
+        write_json(rng_draws, run.rng_profile());
+        outp["rng_draws"] = nlohmann::json::parse(rng_draws.str());
+    }
     cout << outp.dump() << endl;
 }
 } // namespace demo_interactor
@@ -82,7 +107,8 @@ void run(std::istream& is)
 int main(int argc, char* argv[])
 {
     ScopedMpiInit scoped_mpi(&argc, &argv);
-    if (Communicator::comm_world().size() != 1)
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
+        && Communicator::comm_world().size() > 1)
     {
         CELER_LOG(critical) << "This app cannot run in parallel";
         return EXIT_FAILURE;
@@ -0,0 +1,86 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AlignedHostAllocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#include "Types.hh"
+#include "detail/HostAllocation.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Standard allocator for host memory aligned to a cache line.
+ *
+ * This allows a \c std::vector to be grown on the host while guaranteeing the
+ * same alignment as a host-space \c DeviceAllocation.
+ */
+template<class T>
+class AlignedHostAllocator
+{
+    static_assert(alignof(T) <= detail::host_alignment,
+                  "Type is overaligned for host allocation");
+
+  public:
+    //!@{
+    //! Type aliases
+    using value_type = T;
+    //!@}
+
+    //! Alignment of allocations, in bytes
+    static constexpr size_type alignment = detail::host_alignment;
+
+  public:
+    //! Default constructor
+    AlignedHostAllocator() = default;
+
+    //! Construct from an allocator of another type
+    template<class U>
+    AlignedHostAllocator(const AlignedHostAllocator<U>&) noexcept
+    {
+    }
+
+    //! Allocate uninitialized aligned storage
+    T* allocate(std::size_t count)
+    {
+        return reinterpret_cast<T*>(
+            detail::allocate_aligned_host(count * sizeof(T)));
+    }
+
+    //! Free storage
+    void deallocate(T* ptr, std::size_t) noexcept
+    {
+        detail::free_aligned_host(reinterpret_cast<Byte*>(ptr));
+    }
+};
+
+//---------------------------------------------------------------------------//
+//!@{
+//! All aligned host allocators are interchangeable
+template<class T, class U>
+bool operator==(const AlignedHostAllocator<T>&, const AlignedHostAllocator<U>&)
+{
+    return true;
+}
+
+template<class T, class U>
+bool operator!=(const AlignedHostAllocator<T>&, const AlignedHostAllocator<U>&)
+{
+    return false;
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+//! Vector whose data is aligned to a cache line
+template<class T>
+using AlignedHostVector = std::vector<T, AlignedHostAllocator<T>>;
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -41,10 +41,21 @@ inline CELER_FUNCTION void normalize_direction(Real3* direction);
 // Calculate a cartesian unit vector from spherical coordinates
 inline CELER_FUNCTION Real3 from_spherical(real_type costheta, real_type phi);
 
+//---------------------------------------------------------------------------//
+// Calculate a cartesian unit vector from the polar and azimuthal cosines/sines
+inline CELER_FUNCTION Real3
+from_spherical(real_type costheta, const Array<real_type, 2>& azimuth);
+
 //---------------------------------------------------------------------------//
 // Rotate the direction 'dir' according to the reference rotation axis 'rot'
 inline CELER_FUNCTION Real3 rotate(const Real3& dir, const Real3& rot);
 
+//---------------------------------------------------------------------------//
+// Rotate a direction given in spherical coordinates about the axis 'rot'
+inline CELER_FUNCTION Real3 rotate(real_type                   costheta,
+                                   const Array<real_type, 2>& azimuth,
+                                   const Real3&                rot);
+
 //---------------------------------------------------------------------------//
 // Test for being approximately a unit vector
 template<class T, std::size_t N, class SoftEq>
@@ -87,8 +87,24 @@ inline CELER_FUNCTION Real3 from_spherical(real_type costheta, real_type phi)
 {
     CELER_EXPECT(costheta >= -1 && costheta <= 1);
 
+    return from_spherical(costheta, {std::cos(phi), std::sin(phi)});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a cartesian vector from the polar cosine and azimuthal cos/sin.
+ *
+ * The azimuthal angle is given as the pair \c {cos(phi), sin(phi)} (see \c
+ * UniformAzimuthDistribution) so that no trigonometric functions need to be
+ * evaluated.
+ */
+inline CELER_FUNCTION Real3
+from_spherical(real_type costheta, const Array<real_type, 2>& azimuth)
+{
+    CELER_EXPECT(costheta >= -1 && costheta <= 1);
+
     const real_type sintheta = std::sqrt(1 - costheta * costheta);
-    return {sintheta * std::cos(phi), sintheta * std::sin(phi), costheta};
+    return {sintheta * azimuth[0], sintheta * azimuth[1], costheta};
 }
 
 //---------------------------------------------------------------------------//
@@ -178,6 +194,27 @@ inline CELER_FUNCTION Real3 rotate(const Real3& dir, const Real3& rot)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Rotate the spherical direction about the given Z-based scatter direction.
+ *
+ * This is shorthand for
+ * \code
+   rotate(from_spherical(costheta, azimuth), rot)
+ * \endcode
+ * for use with a sampled azimuthal cosine/sine pair:
+ * \code
+   UniformAzimuthDistribution<real_type, SamplingMethod::rejection> sample_phi;
+   result.direction = rotate(costheta, sample_phi(rng), inc_direction_);
+ * \endcode
+ */
+inline CELER_FUNCTION Real3 rotate(real_type                   costheta,
+                                   const Array<real_type, 2>& azimuth,
+                                   const Real3&                rot)
+{
+    return rotate(from_spherical(costheta, azimuth), rot);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Test for being approximately a unit vector.
@@ -11,63 +11,64 @@
 #include "Assert.hh"
 #include "Macros.hh"
 #include "Types.hh"
+#include "detail/AtomicsImpl.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Add to a value, returning the original value.
+ *
+ * On host this is lock-free and safe across threads: integers use a native
+ * fetch-add and floating point values use a compare-and-swap loop. The same
+ * loop is used on devices without a native double-precision add.
+ *
+ * \code
+    auto start = atomic_add<MemOrder::acq_rel>(&counter, count);
+   \endcode
  */
-template<class T>
+template<MemOrder O = MemOrder::relaxed, class T>
 CELER_FORCEINLINE_FUNCTION T atomic_add(T* address, T value)
 {
+    CELER_EXPECT(address);
 #ifdef __CUDA_ARCH__
-    return atomicAdd(address, value);
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    T initial = detail::device_atomic_add(address, value);
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    return initial;
+#elif CELER_HOST_ATOMICS_
+    return detail::host_atomic_add(
+        address, value, O, typename std::is_integral<T>::type{});
 #else
-    CELER_EXPECT(address);
+    // Unsupported host compiler: not thread safe
     T initial = *address;
     *address += value;
     return initial;
 #endif
 }
 
-#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ < 600)
-//---------------------------------------------------------------------------//
-/*!
- * Atomic addition specialization for double-precision on older platforms.
- *
- * From CUDA C Programming guide v10.1 p127
- */
-inline __device__ double atomic_add(double* address, double val)
-{
-    ull_int* address_as_ull = reinterpret_cast<ull_int*>(address);
-    ull_int  old            = *address_as_ull;
-    ull_int  assumed;
-    do
-    {
-        assumed = old;
-        old     = atomicCAS(
-            address_as_ull,
-            assumed,
-            __double_as_longlong(val + __longlong_as_double(assumed)));
-        // Note: uses integer comparison to avoid hang in case of NaN (since
-        // NaN != NaN)
-    } while (assumed != old);
-    return __longlong_as_double(old);
-}
-#endif
-
 //---------------------------------------------------------------------------//
 /*!
  * Set the value to the minimum of the actual and given, returning old.
  */
-template<class T>
+template<MemOrder O = MemOrder::relaxed, class T>
 CELER_FORCEINLINE_FUNCTION T atomic_min(T* address, T value)
 {
+    CELER_EXPECT(address);
 #ifdef __CUDA_ARCH__
-    return atomicMin(address, value);
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    T initial = atomicMin(address, value);
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    return initial;
+#elif CELER_HOST_ATOMICS_
+    return detail::host_atomic_replace_if(
+        address, value, [](T a, T b) { return a < b; }, O);
 #else
-    CELER_EXPECT(address);
+    // Unsupported host compiler: not thread safe
     T initial = *address;
     *address  = celeritas::min(initial, value);
     return initial;
@@ -78,13 +79,22 @@ CELER_FORCEINLINE_FUNCTION T atomic_min(T* address, T value)
 /*!
  * Set the value to the maximum of the actual and given, returning old.
  */
-template<class T>
+template<MemOrder O = MemOrder::relaxed, class T>
 CELER_FORCEINLINE_FUNCTION T atomic_max(T* address, T value)
 {
+    CELER_EXPECT(address);
 #ifdef __CUDA_ARCH__
-    return atomicMax(address, value);
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    T initial = atomicMax(address, value);
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    return initial;
+#elif CELER_HOST_ATOMICS_
+    return detail::host_atomic_replace_if(
+        address, value, [](T a, T b) { return a > b; }, O);
 #else
-    CELER_EXPECT(address);
+    // Unsupported host compiler: not thread safe
     T initial = *address;
     *address  = celeritas::max(initial, value);
     return initial;
@@ -113,5 +123,37 @@ inline __device__ ull_int atomic_max(ull_int* address, ull_int val)
 }
 #endif
 
+//---------------------------------------------------------------------------//
+/*!
+ * Atomically replace the value if it equals \c compare, returning the old.
+ */
+template<MemOrder O = MemOrder::relaxed, class T>
+CELER_FORCEINLINE_FUNCTION T atomic_cas(T* address, T compare, T value)
+{
+    CELER_EXPECT(address);
+#ifdef __CUDA_ARCH__
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    T initial = atomicCAS(address, compare, value);
+    if (O == MemOrder::acq_rel)
+        __threadfence();
+    return initial;
+#elif CELER_HOST_ATOMICS_
+    __atomic_compare_exchange(address,
+                              &compare,
+                              &value,
+                              /* weak = */ false,
+                              detail::to_builtin_order(O),
+                              detail::to_builtin_load_order(O));
+    return compare;
+#else
+    // Unsupported host compiler: not thread safe
+    T initial = *address;
+    if (initial == compare)
+        *address = value;
+    return initial;
+#endif
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,142 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Collection.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <type_traits>
+#include "Assert.hh"
+#include "Macros.hh"
+#include "OpaqueId.hh"
+#include "Span.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Index of a single item in a collection of T
+template<class T>
+using ItemId = OpaqueId<T>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Contiguous range of items in a collection of T.
+ *
+ * Data structures that refer to a variable number of other items (e.g. the
+ * elemental components of a material) should store an item range rather than
+ * a pointer, so that the data remains valid when it is copied to another
+ * memory space.
+ */
+template<class T>
+class ItemRange
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ItemIdT    = ItemId<T>;
+    using value_type = typename ItemIdT::value_type;
+    //!@}
+
+  public:
+    //! Construct an empty range
+    ItemRange() = default;
+
+    //! Construct from the first item and one past the last
+    CELER_FUNCTION ItemRange(ItemIdT first, ItemIdT last)
+        : begin_(first.unchecked_get()), end_(last.unchecked_get())
+    {
+        CELER_EXPECT(begin_ <= end_);
+    }
+
+    //! First item in the range
+    CELER_FUNCTION ItemIdT begin() const { return ItemIdT{begin_}; }
+
+    //! One past the last item in the range
+    CELER_FUNCTION ItemIdT end() const { return ItemIdT{end_}; }
+
+    //! Number of items
+    CELER_FUNCTION value_type size() const { return end_ - begin_; }
+
+    //! Whether the range has no items
+    CELER_FUNCTION bool empty() const { return begin_ == end_; }
+
+    //! Get the ID of the i'th item in the range
+    CELER_FUNCTION ItemIdT operator[](value_type i) const
+    {
+        CELER_EXPECT(i < this->size());
+        return ItemIdT{begin_ + i};
+    }
+
+  private:
+    value_type begin_{0};
+    value_type end_{0};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reference to a contiguous pool of items in a single memory space.
+ *
+ * Items are accessed by ID (the index type can be changed from \c ItemId<T>
+ * when a collection is indexed by another quantity, e.g. per-element data
+ * indexed by \c ElementDefId), and ranges of items resolve to spans.
+ *
+ * \sa CollectionArena (owns the pointed-to data)
+ */
+template<class T, class I = ItemId<typename std::remove_const<T>::type>>
+class Collection
+{
+  public:
+    //!@{
+    //! Type aliases
+    using value_type = typename std::remove_const<T>::type;
+    using SpanT      = Span<T>;
+    using ItemIdT    = I;
+    using ItemRangeT = ItemRange<value_type>;
+    //!@}
+
+  public:
+    //! Construct with no data
+    Collection() = default;
+
+    //! Construct from a span of data
+    explicit CELER_FUNCTION Collection(SpanT data) : data_(data) {}
+
+    //! Construct from a mutable collection
+    template<class U>
+    CELER_FUNCTION Collection(const Collection<U, I>& other)
+        : data_(other.data())
+    {
+    }
+
+    //! Access a single item
+    CELER_FUNCTION T& operator[](ItemIdT id) const
+    {
+        CELER_EXPECT(id < data_.size());
+        return data_[id.get()];
+    }
+
+    //! Access a range of items
+    CELER_FUNCTION SpanT operator[](ItemRangeT range) const
+    {
+        CELER_EXPECT(range.end().unchecked_get() <= data_.size());
+        return data_.subspan(range.begin().unchecked_get(), range.size());
+    }
+
+    //! Number of items
+    CELER_FUNCTION size_type size() const { return data_.size(); }
+
+    //! Whether the collection is empty
+    CELER_FUNCTION bool empty() const { return data_.empty(); }
+
+    //! Access all items
+    CELER_FUNCTION SpanT data() const { return data_; }
+
+  private:
+    SpanT data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
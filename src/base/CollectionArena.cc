@@ -0,0 +1,31 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionArena.cc
+//---------------------------------------------------------------------------//
+#include "CollectionArena.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the full host block to the device in a single transfer.
+ *
+ * No more items can be inserted afterward.
+ */
+void CollectionArena::copy_to_device()
+{
+    CELER_EXPECT(!host_.empty());
+    CELER_EXPECT(device_.empty());
+
+    DeviceAllocation device(host_.size());
+    device.copy_to_device(this->host_data());
+    device_ = std::move(device);
+
+    CELER_ENSURE(this->has_device_data());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
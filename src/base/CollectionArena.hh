@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionArena.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "DeviceAllocation.hh"
+#include "Span.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Location of a packed array of T inside a collection arena.
+ */
+template<class T>
+struct ArenaSlot
+{
+    size_type offset = 0; //!< Offset in bytes from the start of the arena
+    size_type size   = 0; //!< Number of items
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Pack several pointer-free arrays into a single contiguous block.
+ *
+ * Params classes build their data as host vectors of plain structs that refer
+ * to each other through \c ItemId and \c ItemRange, then insert each vector
+ * into the arena. The packed host block is copied to device memory with a
+ * single transfer, and since it contains no pointers the same block could be
+ * written to a file or placed in shared memory unchanged. Only the top-level
+ * views, created from the arena base address plus each slot's offset, depend
+ * on where the block lives.
+ *
+ * \code
+    CollectionArena arena;
+    auto elements_slot = arena.insert(make_span(elements));
+    auto shells_slot = arena.insert(make_span(shells));
+    arena.copy_to_device();
+
+    Span<const Element> device_elements = arena.device_view(elements_slot);
+   \endcode
+ */
+class CollectionArena
+{
+  public:
+    //!@{
+    //! Type aliases
+    using constSpanBytes = Span<const Byte>;
+    //!@}
+
+    //! Alignment of each packed array
+    static constexpr size_type alignment = alignof(std::max_align_t);
+
+  public:
+    // Append an array of items to the host block
+    template<class T>
+    inline ArenaSlot<T> insert(Span<const T> items);
+
+    //! Append an array of items to the host block
+    template<class T>
+    ArenaSlot<T> insert(Span<T> items)
+    {
+        return this->insert(Span<const T>{items.data(), items.size()});
+    }
+
+    // Copy the full host block to the device in a single transfer
+    void copy_to_device();
+
+    //// ACCESSORS ////
+
+    //! Total number of packed bytes, including padding
+    size_type num_bytes() const { return host_.size(); }
+
+    //! Whether data has been copied to the device
+    bool has_device_data() const { return !device_.empty(); }
+
+    //! Packed host data
+    constSpanBytes host_data() const { return make_span(host_); }
+
+    // View an array in host memory
+    template<class T>
+    inline Span<const T> host_view(ArenaSlot<T> slot) const;
+
+    // View an array in device memory
+    template<class T>
+    inline Span<const T> device_view(ArenaSlot<T> slot) const;
+
+  private:
+    std::vector<Byte> host_;
+    DeviceAllocation  device_;
+
+    template<class T>
+    static inline Span<const T> view(const Byte* base, ArenaSlot<T> slot);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "CollectionArena.i.hh"
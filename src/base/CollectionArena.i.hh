@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionArena.i.hh
+//---------------------------------------------------------------------------//
+#include <cstring>
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Append an array of items to the host block.
+ *
+ * Items must be trivially copyable and must not contain pointers (use \c
+ * ItemRange to refer to other items instead). This invalidates previously
+ * returned host views but not the slots.
+ */
+template<class T>
+ArenaSlot<T> CollectionArena::insert(Span<const T> items)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Arena items must be trivially copyable");
+    static_assert(alignof(T) <= alignment, "Arena item is overaligned");
+    CELER_EXPECT(device_.empty());
+
+    ArenaSlot<T> result;
+    result.offset = (host_.size() + alignment - 1) / alignment * alignment;
+    result.size   = items.size();
+    host_.resize(result.offset + items.size() * sizeof(T));
+    if (!items.empty())
+    {
+        std::memcpy(host_.data() + result.offset,
+                    items.data(),
+                    items.size() * sizeof(T));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * View an array in host memory.
+ */
+template<class T>
+Span<const T> CollectionArena::host_view(ArenaSlot<T> slot) const
+{
+    return CollectionArena::view(host_.data(), slot);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * View an array in device memory.
+ */
+template<class T>
+Span<const T> CollectionArena::device_view(ArenaSlot<T> slot) const
+{
+    CELER_EXPECT(this->has_device_data());
+    return CollectionArena::view(device_.device_pointers().data(), slot);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a view from a base address.
+ */
+template<class T>
+Span<const T> CollectionArena::view(const Byte* base, ArenaSlot<T> slot)
+{
+    CELER_EXPECT(base);
+    return {reinterpret_cast<const T*>(base + slot.offset), slot.size};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
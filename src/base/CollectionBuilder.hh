@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iterator>
+#include <vector>
+#include "Assert.hh"
+#include "Collection.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Append items to a host vector, returning IDs and ranges instead of pointers.
+ *
+ * Because the returned handles are indices, the vector can be reallocated
+ * while it is being built and the results can later be copied to any memory
+ * space without modification.
+ * \code
+    std::vector<real_type> reals;
+    auto build = make_builder(&reals);
+    ItemRange<real_type> params = build.insert_back(inp.begin(), inp.end());
+   \endcode
+ */
+template<class T>
+class CollectionBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ItemIdT    = ItemId<T>;
+    using ItemRangeT = ItemRange<T>;
+    //!@}
+
+  public:
+    //! Construct with a pointer to the vector being built
+    explicit CollectionBuilder(std::vector<T>* data) : data_(data)
+    {
+        CELER_EXPECT(data_);
+    }
+
+    //! Reserve space for a total number of items
+    void reserve(size_type count) { data_->reserve(count); }
+
+    //! Add a single item
+    ItemIdT push_back(const T& value)
+    {
+        ItemIdT result(data_->size());
+        data_->push_back(value);
+        return result;
+    }
+
+    //! Add a range of items
+    template<class InputIterator>
+    ItemRangeT insert_back(InputIterator first, InputIterator last)
+    {
+        ItemIdT start(data_->size());
+        data_->insert(data_->end(), first, last);
+        return {start, ItemIdT(data_->size())};
+    }
+
+    //! Add a number of default-constructed items
+    ItemRangeT resize_back(size_type count)
+    {
+        ItemIdT start(data_->size());
+        data_->resize(data_->size() + count);
+        return {start, ItemIdT(data_->size())};
+    }
+
+    //! Number of items
+    size_type size() const { return data_->size(); }
+
+    //! Access a range of items on the host while building
+    Span<T> operator[](ItemRangeT range)
+    {
+        return Collection<T>(make_span(*data_))[range];
+    }
+
+  private:
+    std::vector<T>* data_;
+};
+
+//---------------------------------------------------------------------------//
+//! Create a builder for a host vector
+template<class T>
+inline CollectionBuilder<T> make_builder(std::vector<T>* data)
+{
+    return CollectionBuilder<T>(data);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
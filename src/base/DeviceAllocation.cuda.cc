@@ -7,54 +7,128 @@
 //---------------------------------------------------------------------------//
 #include "DeviceAllocation.hh"
 
+#include <cstring>
 #include <cuda_runtime_api.h>
 #include "Assert.hh"
 #include "comm/Device.hh"
+#include "MemoryPool.hh"
+#include "detail/HostAllocation.hh"
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+celeritas::Byte* allocate_device(celeritas::size_type bytes)
+{
+    void* ptr = nullptr;
+    CELER_CUDA_CALL(cudaMalloc(&ptr, bytes));
+    return static_cast<celeritas::Byte*>(ptr);
+}
+
+void free_device(celeritas::Byte* ptr)
+{
+    CELER_CUDA_CALL(cudaFree(ptr));
+}
+//---------------------------------------------------------------------------//
+} // namespace
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Allocate a buffer with the given number of bytes.
+ *
+ * The data is stored on device if one is available, and on host otherwise.
+ */
+DeviceAllocation::DeviceAllocation(size_type bytes)
+    : DeviceAllocation(bytes,
+                       is_device_enabled() ? MemSpace::device : MemSpace::host)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate a buffer with the given number of bytes in a memory space.
  */
-DeviceAllocation::DeviceAllocation(size_type bytes) : size_(bytes)
+DeviceAllocation::DeviceAllocation(size_type bytes, MemSpace space)
+    : size_(bytes), data_(nullptr, MemSpaceDeleter{space, bytes})
 {
     CELER_EXPECT(bytes > 0);
-    CELER_EXPECT(is_device_enabled());
-    void* ptr = nullptr;
-    CELER_CUDA_CALL(cudaMalloc(&ptr, bytes));
-    data_.reset(static_cast<Byte*>(ptr));
+    CELER_EXPECT(space == MemSpace::host || is_device_enabled());
+    data_.reset(DeviceAllocation::pool(space).allocate(bytes));
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Copy data to device.
+ *
+ * The copied data may be smaller than the allocation (e.g. after a
+ * DeviceVector is resized), in which case only the leading bytes are written.
  */
 void DeviceAllocation::copy_to_device(constSpanBytes bytes)
 {
     CELER_EXPECT(!this->empty());
-    CELER_EXPECT(bytes.size() == this->size());
-    CELER_CUDA_CALL(cudaMemcpy(
-        data_.get(), bytes.data(), bytes.size(), cudaMemcpyHostToDevice));
+    CELER_EXPECT(bytes.size() <= this->size());
+    if (this->memspace() == MemSpace::device)
+    {
+        CELER_CUDA_CALL(cudaMemcpy(
+            data_.get(), bytes.data(), bytes.size(), cudaMemcpyHostToDevice));
+    }
+    else
+    {
+        std::memcpy(data_.get(), bytes.data(), bytes.size());
+    }
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Copy data to host.
+ *
+ * Only the leading bytes are read if the destination is smaller than the
+ * allocation.
  */
 void DeviceAllocation::copy_to_host(SpanBytes bytes) const
 {
     CELER_EXPECT(!this->empty());
-    CELER_EXPECT(bytes.size() == this->size());
-    CELER_CUDA_CALL(cudaMemcpy(
-        bytes.data(), data_.get(), this->size(), cudaMemcpyDeviceToHost));
+    CELER_EXPECT(bytes.size() <= this->size());
+    if (this->memspace() == MemSpace::device)
+    {
+        CELER_CUDA_CALL(cudaMemcpy(
+            bytes.data(), data_.get(), bytes.size(), cudaMemcpyDeviceToHost));
+    }
+    else
+    {
+        std::memcpy(bytes.data(), data_.get(), bytes.size());
+    }
 }
 
 //---------------------------------------------------------------------------//
-//! Deleter frees cuda data
-void DeviceAllocation::CudaFreeDeleter::operator()(Byte* ptr) const
+/*!
+ * Caching memory pool for a memory space.
+ *
+ * The pools are never destroyed: the CUDA runtime may already be shut down
+ * when static objects are destroyed, and allocations owned by other static
+ * objects may be released after the pools would have been destroyed.
+ */
+MemoryPool& DeviceAllocation::pool(MemSpace space)
 {
-    CELER_CUDA_CALL(cudaFree(ptr));
+    if (space == MemSpace::device)
+    {
+        static MemoryPool* device_pool
+            = new MemoryPool(allocate_device, free_device);
+        return *device_pool;
+    }
+    static MemoryPool* host_pool = new MemoryPool(detail::allocate_aligned_host,
+                                                  detail::free_aligned_host);
+    return *host_pool;
+}
+
+//---------------------------------------------------------------------------//
+//! Deleter returns cuda or host data to the pool
+void DeviceAllocation::MemSpaceDeleter::operator()(Byte* ptr) const
+{
+    DeviceAllocation::pool(memspace).deallocate(ptr, num_bytes);
 }
 
 //---------------------------------------------------------------------------//
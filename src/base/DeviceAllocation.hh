@@ -14,6 +14,8 @@
 
 namespace celeritas
 {
+class MemoryPool;
+
 //---------------------------------------------------------------------------//
 /*!
  * Allocate raw uninitialized memory.
@@ -22,6 +24,16 @@ namespace celeritas
  * device memory. It allows Storage classes to allocate and manage device
  * memory without using `thrust`, which requires NVCC and propagates that
  * requirement into all upstream code.
+ *
+ * The memory can instead live in cache-aligned host memory, which lets the
+ * same storage classes provide valid pointers when no device is available. By
+ * default the allocation is on device if CUDA is enabled and a device is
+ * present, and on host otherwise. The "device" accessors and copy methods
+ * refer to whichever memory space was chosen at construction.
+ *
+ * Memory is obtained from a caching \c MemoryPool for each memory space, so
+ * destroying an allocation and creating another of similar size (e.g. a
+ * temporary vector every step) does not call the underlying allocator.
  */
 class DeviceAllocation
 {
@@ -36,9 +48,12 @@ class DeviceAllocation
     // Construct in unallocated state
     DeviceAllocation() = default;
 
-    // Construct and allocate a number of bytes
+    // Construct and allocate a number of bytes in the default memory space
     DeviceAllocation(size_type num_bytes);
 
+    // Construct and allocate a number of bytes in the given memory space
+    DeviceAllocation(size_type num_bytes, MemSpace space);
+
     // Swap with another allocation
     inline void swap(DeviceAllocation& other) noexcept;
 
@@ -50,6 +65,9 @@ class DeviceAllocation
     //! Whether memory is allocated
     bool empty() const { return size_ == 0; }
 
+    //! Memory space in which the data is allocated
+    MemSpace memspace() const { return data_.get_deleter().memspace; }
+
     //// DEVICE ACCESSORS ////
 
     // Get the device pointer
@@ -64,12 +82,19 @@ class DeviceAllocation
     // Copy data to host
     void copy_to_host(SpanBytes bytes) const;
 
+    //// STATIC FUNCTIONS ////
+
+    // Caching memory pool for a memory space
+    static MemoryPool& pool(MemSpace space);
+
   private:
-    struct CudaFreeDeleter
+    struct MemSpaceDeleter
     {
-        void operator()(Byte*) const;
+        MemSpace  memspace;  //!< Value-initialized to host
+        size_type num_bytes; //!< Requested size of the allocation
+        void      operator()(Byte*) const;
     };
-    using DeviceUniquePtr = std::unique_ptr<Byte[], CudaFreeDeleter>;
+    using DeviceUniquePtr = std::unique_ptr<Byte[], MemSpaceDeleter>;
 
     //// DATA ////
 
@@ -6,42 +6,103 @@
 //! \file DeviceAllocation.nocuda.cc
 //---------------------------------------------------------------------------//
 #include "DeviceAllocation.hh"
+
+#include <cstring>
 #include "Assert.hh"
+#include "MemoryPool.hh"
+#include "detail/HostAllocation.hh"
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+celeritas::Byte* allocate_device(celeritas::size_type)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+
+void free_device(celeritas::Byte*)
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+//---------------------------------------------------------------------------//
+} // namespace
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Prevent allocation because CUDA is disabled.
+ * Allocate a host buffer because CUDA is disabled.
  */
-DeviceAllocation::DeviceAllocation(size_type)
+DeviceAllocation::DeviceAllocation(size_type bytes)
+    : DeviceAllocation(bytes, MemSpace::host)
 {
-    CELER_NOT_CONFIGURED("CUDA");
 }
 
 //---------------------------------------------------------------------------//
-//! Deleter should never be called on CPU
-void DeviceAllocation::CudaFreeDeleter::operator()(Byte*) const
+/*!
+ * Allocate a host buffer (device allocation is prohibited).
+ */
+DeviceAllocation::DeviceAllocation(size_type bytes, MemSpace space)
+    : size_(bytes), data_(nullptr, MemSpaceDeleter{space, bytes})
 {
-    CELER_ASSERT_UNREACHABLE();
+    CELER_EXPECT(bytes > 0);
+    if (space == MemSpace::device)
+    {
+        CELER_NOT_CONFIGURED("CUDA");
+    }
+    data_.reset(DeviceAllocation::pool(space).allocate(bytes));
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Copy data to device (not implemented when cuda is disabled).
+ * Caching memory pool for a memory space.
+ *
+ * The device pool is never used without CUDA, but its statistics can still be
+ * queried. The pools are never destroyed so that allocations owned by other
+ * static objects can be released during static destruction.
  */
-void DeviceAllocation::copy_to_device(constSpanBytes)
+MemoryPool& DeviceAllocation::pool(MemSpace space)
 {
-    CELER_ASSERT_UNREACHABLE();
+    if (space == MemSpace::device)
+    {
+        static MemoryPool* device_pool
+            = new MemoryPool(allocate_device, free_device);
+        return *device_pool;
+    }
+    static MemoryPool* host_pool = new MemoryPool(detail::allocate_aligned_host,
+                                                  detail::free_aligned_host);
+    return *host_pool;
+}
+
+//---------------------------------------------------------------------------//
+//! Deleter returns host data to the pool
+void DeviceAllocation::MemSpaceDeleter::operator()(Byte* ptr) const
+{
+    DeviceAllocation::pool(memspace).deallocate(ptr, num_bytes);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Copy data to host (not implemented when cuda is disabled).
+ * Copy data into the host allocation.
  */
-void DeviceAllocation::copy_to_host(SpanBytes) const
+void DeviceAllocation::copy_to_device(constSpanBytes bytes)
 {
-    CELER_ASSERT_UNREACHABLE();
+    CELER_EXPECT(!this->empty());
+    CELER_EXPECT(bytes.size() <= this->size());
+    std::memcpy(data_.get(), bytes.data(), bytes.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy data out of the host allocation.
+ */
+void DeviceAllocation::copy_to_host(SpanBytes bytes) const
+{
+    CELER_EXPECT(!this->empty());
+    CELER_EXPECT(bytes.size() <= this->size());
+    std::memcpy(bytes.data(), data_.get(), bytes.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -22,6 +22,9 @@ namespace celeritas
  * (dynamic resizing and assignment without memory reallocation) uses \c
  * thrust::device_vector.
  *
+ * The storage is on device when available and in host memory otherwise; see
+ * \c DeviceAllocation.
+ *
  * \code
     DeviceVector<double> myvec(100);
     myvec.copy_to_device(make_span(hostvec));
@@ -52,6 +55,9 @@ class DeviceVector
     // Construct with a number of elements
     explicit DeviceVector(size_type count);
 
+    // Construct with a number of elements in a particular memory space
+    DeviceVector(size_type count, MemSpace space);
+
     // Swap with another vector
     inline void swap(DeviceVector& other) noexcept;
 
@@ -69,6 +75,9 @@ class DeviceVector
     //! Whether any elements are stored
     bool empty() const { return size_ == 0; }
 
+    //! Memory space of the stored elements
+    MemSpace memspace() const { return allocation_.memspace(); }
+
     //// DEVICE ACCESSORS ////
 
     // Copy data to device
@@ -18,6 +18,16 @@ DeviceVector<T>::DeviceVector(size_type count)
 {
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a number of elements in the given memory space.
+ */
+template<class T>
+DeviceVector<T>::DeviceVector(size_type count, MemSpace space)
+    : allocation_(count * sizeof(T), space), size_(count), capacity_(count)
+{
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the device data pointer.
@@ -46,11 +56,14 @@ void DeviceVector<T>::resize(size_type size)
 //---------------------------------------------------------------------------//
 /*!
  * Copy data to device.
+ *
+ * If the input is smaller than the vector, only the leading elements are
+ * overwritten.
  */
 template<class T>
 void DeviceVector<T>::copy_to_device(constSpan_t data)
 {
-    CELER_EXPECT(data.size() == this->size());
+    CELER_EXPECT(data.size() <= this->size());
     allocation_.copy_to_device(
         {reinterpret_cast<const Byte*>(data.data()), data.size() * sizeof(T)});
 }
@@ -58,11 +71,14 @@ void DeviceVector<T>::copy_to_device(constSpan_t data)
 //---------------------------------------------------------------------------//
 /*!
  * Copy data to host.
+ *
+ * If the output is smaller than the vector, only the leading elements are
+ * copied.
  */
 template<class T>
 void DeviceVector<T>::copy_to_host(Span_t data) const
 {
-    CELER_EXPECT(data.size() == this->size());
+    CELER_EXPECT(data.size() <= this->size());
     allocation_.copy_to_host(
         {reinterpret_cast<Byte*>(data.data()), data.size() * sizeof(T)});
 }
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostKernelLauncher.cc
+//---------------------------------------------------------------------------//
+#include "HostKernelLauncher.hh"
+
+#include <algorithm>
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a label, using the global thread pool.
+ */
+HostKernelLauncher::HostKernelLauncher(std::string label)
+    : HostKernelLauncher(std::move(label), ThreadPool::global())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a label and thread pool.
+ */
+HostKernelLauncher::HostKernelLauncher(std::string label, SPThreadPool pool)
+    : label_(std::move(label)), pool_(std::move(pool))
+{
+    CELER_EXPECT(!label_.empty());
+    CELER_EXPECT(pool_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of thread IDs per chunk for this launch.
+ *
+ * The automatic grain size targets several chunks per host thread so that
+ * idle threads can steal work when per-track costs are uneven.
+ */
+size_type HostKernelLauncher::calc_grain_size(size_type num_threads) const
+{
+    if (grain_size_ > 0)
+    {
+        return grain_size_;
+    }
+    constexpr size_type chunks_per_thread = 8;
+    size_type num_chunks = pool_->num_threads() * chunks_per_thread;
+    return std::max<size_type>(1, (num_threads + num_chunks - 1) / num_chunks);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostKernelLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include "ThreadPool.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Launch a one-thread-per-track "kernel" on host threads.
+ *
+ * This is the host analog of \c KernelParamCalculator: a kernel body that is
+ * written in terms of a \c ThreadId (i.e. the inside of the \c if statement
+ * in a CUDA kernel) is called for every thread index in [0, num_threads) by
+ * a persistent \c ThreadPool. Thread indices are split into contiguous
+ * chunks of \c grain_size consecutive IDs; a grain size of zero (the
+ * default) chooses a size that gives several chunks per host thread.
+ *
+ * \code
+    HostKernelLauncher launch_kernel("sim_init");
+    launch_kernel(states.size(), [&](ThreadId tid) {
+        SimTrackView sim_view(states, tid);
+        sim_view = SimTrackView::Initializer_t{};
+    });
+   \endcode
+ *
+ * The accumulated wall time, number of launches, and scheduler statistics are
+ * recorded for each launcher instance. A large idle time or number of steals
+ * relative to the number of tasks suggests adjusting the grain size.
+ */
+class HostKernelLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SPThreadPool = std::shared_ptr<ThreadPool>;
+    //!@}
+
+    //! Accumulated timing for all launches of this kernel
+    struct Timing
+    {
+        size_type         num_launches{0}; //!< Number of calls
+        size_type         num_threads{0};  //!< Total kernel threads launched
+        real_type         time{0};         //!< Elapsed wall time [s]
+        ThreadPool::Stats scheduling;      //!< Work-stealing statistics
+    };
+
+  public:
+    // Construct with a label, using the global thread pool
+    explicit HostKernelLauncher(std::string label);
+
+    // Construct with a label and thread pool
+    HostKernelLauncher(std::string label, SPThreadPool pool);
+
+    // Call the kernel for each thread ID in [0, num_threads)
+    template<class F>
+    inline void operator()(size_type num_threads, F&& kernel);
+
+    //// ACCESSORS ////
+
+    //! Kernel name
+    const std::string& label() const { return label_; }
+
+    //! Number of consecutive thread IDs per chunk (zero for automatic)
+    size_type grain_size() const { return grain_size_; }
+
+    //! Set the number of consecutive thread IDs per chunk
+    void grain_size(size_type size) { grain_size_ = size; }
+
+    //! Accumulated timing
+    const Timing& timing() const { return timing_; }
+
+    //! Thread pool
+    const SPThreadPool& pool() const { return pool_; }
+
+  private:
+    std::string  label_;
+    SPThreadPool pool_;
+    size_type    grain_size_{0};
+    Timing       timing_;
+
+    // Number of thread IDs per chunk for this launch
+    size_type calc_grain_size(size_type num_threads) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "HostKernelLauncher.i.hh"
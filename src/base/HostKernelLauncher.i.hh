@@ -0,0 +1,38 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostKernelLauncher.i.hh
+//---------------------------------------------------------------------------//
+#include "Range.hh"
+#include "Stopwatch.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Call the kernel for each thread ID in [0, num_threads).
+ *
+ * The kernel must be safe to call concurrently for different thread IDs.
+ */
+template<class F>
+void HostKernelLauncher::operator()(size_type num_threads, F&& kernel)
+{
+    Stopwatch get_time;
+    timing_.scheduling += pool_->parallel_for(
+        num_threads,
+        this->calc_grain_size(num_threads),
+        [&kernel](size_type begin, size_type end) {
+            for (auto i : range(begin, end))
+            {
+                kernel(ThreadId(i));
+            }
+        });
+    timing_.time += get_time();
+    timing_.num_threads += num_threads;
+    ++timing_.num_launches;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
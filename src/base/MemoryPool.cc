@@ -0,0 +1,189 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MemoryPool.cc
+//---------------------------------------------------------------------------//
+#include "MemoryPool.hh"
+
+#include <algorithm>
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with underlying allocation functions.
+ */
+MemoryPool::MemoryPool(AllocateFn allocate, FreeFn free)
+    : allocate_(allocate), free_(free)
+{
+    CELER_EXPECT(allocate_);
+    CELER_EXPECT(free_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release all cached blocks.
+ *
+ * Blocks that are still in use are not freed.
+ */
+MemoryPool::~MemoryPool()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    this->trim_impl();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate a block with at least the given number of bytes.
+ *
+ * A cached block of the same size class is returned if available.
+ */
+Byte* MemoryPool::allocate(size_type num_bytes)
+{
+    CELER_EXPECT(num_bytes > 0);
+    const size_type size = MemoryPool::block_size(num_bytes);
+
+    Byte* result = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.num_requests;
+        auto iter = free_blocks_.find(size);
+        if (iter != free_blocks_.end() && !iter->second.empty())
+        {
+            result = iter->second.back();
+            iter->second.pop_back();
+            ++stats_.num_reused;
+            stats_.bytes_cached -= size;
+            stats_.bytes_in_use += size;
+            stats_.max_bytes_in_use
+                = std::max(stats_.max_bytes_in_use, stats_.bytes_in_use);
+            return result;
+        }
+    }
+
+    // Allocate outside the lock since the underlying call may be slow
+    result = (*allocate_)(size);
+    CELER_ASSERT(result);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.num_system_allocs;
+    stats_.bytes_in_use += size;
+    stats_.max_bytes_in_use
+        = std::max(stats_.max_bytes_in_use, stats_.bytes_in_use);
+    stats_.max_bytes_reserved = std::max(
+        stats_.max_bytes_reserved, stats_.bytes_in_use + stats_.bytes_cached);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return a block for reuse.
+ *
+ * The number of bytes must be the same as the original request.
+ */
+void MemoryPool::deallocate(Byte* ptr, size_type num_bytes)
+{
+    if (!ptr)
+    {
+        return;
+    }
+    const size_type size = MemoryPool::block_size(num_bytes);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    CELER_ASSERT(stats_.bytes_in_use >= size);
+    free_blocks_[size].push_back(ptr);
+    stats_.bytes_in_use -= size;
+    stats_.bytes_cached += size;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release cached blocks to the underlying allocator.
+ *
+ * \return Number of bytes released
+ */
+size_type MemoryPool::trim()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return this->trim_impl();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a snapshot of the statistics.
+ */
+auto MemoryPool::stats() const -> Stats
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset counters and high-water marks to the current usage.
+ */
+void MemoryPool::reset_stats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats result;
+    result.bytes_in_use       = stats_.bytes_in_use;
+    result.bytes_cached       = stats_.bytes_cached;
+    result.max_bytes_in_use   = stats_.bytes_in_use;
+    result.max_bytes_reserved = stats_.bytes_in_use + stats_.bytes_cached;
+    stats_                    = result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Size of the block used for a given request.
+ *
+ * Sizes above the minimum are rounded up to a multiple of one quarter of the
+ * next-lower power of two, so that at most 25% of a block is wasted.
+ */
+size_type MemoryPool::block_size(size_type num_bytes)
+{
+    CELER_EXPECT(num_bytes > 0);
+    constexpr size_type min_block_size = 256;
+    if (num_bytes <= min_block_size)
+    {
+        return min_block_size;
+    }
+
+    size_type pow2 = min_block_size;
+    while (2 * pow2 < num_bytes)
+    {
+        pow2 *= 2;
+    }
+    // pow2 < num_bytes <= 2 * pow2
+    const size_type step = pow2 / 4;
+    return ((num_bytes + step - 1) / step) * step;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Free cached blocks while holding the lock.
+ */
+size_type MemoryPool::trim_impl()
+{
+    size_type result = 0;
+    for (auto& size_blocks : free_blocks_)
+    {
+        for (Byte* ptr : size_blocks.second)
+        {
+            (*free_)(ptr);
+            ++stats_.num_system_frees;
+            result += size_blocks.first;
+        }
+    }
+    free_blocks_.clear();
+    stats_.bytes_cached -= result;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MemoryPool.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Caching allocator that recycles freed blocks by size class.
+ *
+ * Requests are rounded up to a size class (four classes per power of two,
+ * with a minimum of 256 bytes) and freed blocks are kept in per-class free
+ * lists instead of being returned to the underlying allocator. Storage that
+ * is repeatedly created and destroyed with similar sizes (e.g. temporary
+ * vectors every step, or state stores every run) therefore reaches a steady
+ * state with no calls to \c cudaMalloc or \c malloc.
+ *
+ * Cached memory is only released by \c trim or when the pool is destroyed.
+ * All operations are thread safe.
+ *
+ * Each \c DeviceAllocation uses the pool for its memory space (see \c
+ * DeviceAllocation::pool).
+ */
+class MemoryPool
+{
+  public:
+    //!@{
+    //! Type aliases
+    using AllocateFn = Byte* (*)(size_type);
+    using FreeFn     = void (*)(Byte*);
+    //!@}
+
+    //! Allocation statistics
+    struct Stats
+    {
+        size_type num_requests{0};       //!< Calls to allocate
+        size_type num_reused{0};         //!< Requests satisfied from cache
+        size_type num_system_allocs{0};  //!< Calls to the underlying alloc
+        size_type num_system_frees{0};   //!< Calls to the underlying free
+        size_type bytes_in_use{0};       //!< Bytes of blocks in use
+        size_type bytes_cached{0};       //!< Bytes of blocks in free lists
+        size_type max_bytes_in_use{0};   //!< High-water mark of bytes in use
+        size_type max_bytes_reserved{0}; //!< High-water mark of in use+cached
+    };
+
+  public:
+    // Construct with underlying allocation functions
+    MemoryPool(AllocateFn allocate, FreeFn free);
+
+    // Release all cached blocks
+    ~MemoryPool();
+
+    //!@{
+    //! Prevent copying and moving
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+    //!@}
+
+    // Allocate a block with at least the given number of bytes
+    Byte* allocate(size_type num_bytes);
+
+    // Return a block for reuse
+    void deallocate(Byte* ptr, size_type num_bytes);
+
+    // Release cached blocks to the underlying allocator
+    size_type trim();
+
+    // Get a snapshot of the statistics
+    Stats stats() const;
+
+    // Reset counters and high-water marks to the current usage
+    void reset_stats();
+
+    // Size of the block used for a given request
+    static size_type block_size(size_type num_bytes);
+
+  private:
+    AllocateFn allocate_;
+    FreeFn     free_;
+
+    mutable std::mutex                                  mutex_;
+    std::unordered_map<size_type, std::vector<Byte*>> free_blocks_;
+    Stats                                               stats_;
+
+    size_type trim_impl();
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
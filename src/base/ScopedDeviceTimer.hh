@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ScopedDeviceTimer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <utility>
+#include "TimerRegistry.hh"
+#include "detail/DeviceTimerEvents.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Time the device work launched inside a named scope.
+ *
+ * Kernel launches return before the kernel executes, so a \c ScopedTimer
+ * around a launch records only the launch latency. This timer instead records
+ * events on the default stream at construction and destruction; the time
+ * between them is added to the scope when the registry's results are merged.
+ * The call count is updated immediately. Without CUDA, the host time is
+ * recorded.
+ *
+ * \code
+    {
+        ScopedDeviceTimer time_kernel("KleinNishinaModel::interact");
+        detail::klein_nishina_interact(interface_, pointers);
+    }
+   \endcode
+ */
+class ScopedDeviceTimer
+{
+  public:
+    // Start timing a scope in the global registry
+    explicit inline ScopedDeviceTimer(const char* name);
+
+    // Start timing a scope in the given registry
+    inline ScopedDeviceTimer(const char* name, TimerRegistry& registry);
+
+    // Record the end of the device work
+    inline ~ScopedDeviceTimer();
+
+    //!@{
+    //! Prevent copying and moving
+    ScopedDeviceTimer(const ScopedDeviceTimer&) = delete;
+    ScopedDeviceTimer& operator=(const ScopedDeviceTimer&) = delete;
+    //!@}
+
+  private:
+    TimerRegistry::ThreadTree* tree_{nullptr};
+    TimerRegistry::NodeId      node_{0};
+    detail::DeviceTimerEvents  events_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing a scope in the global registry.
+ */
+ScopedDeviceTimer::ScopedDeviceTimer(const char* name)
+    : ScopedDeviceTimer(name, TimerRegistry::global())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing a scope in the given registry.
+ */
+ScopedDeviceTimer::ScopedDeviceTimer(const char* name, TimerRegistry& registry)
+{
+    if (registry.enabled())
+    {
+        tree_   = &registry.thread_tree();
+        node_   = TimerRegistry::push(*tree_, name);
+        events_ = TimerRegistry::acquire_events(*tree_, node_);
+        events_.start();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the end of the device work.
+ */
+ScopedDeviceTimer::~ScopedDeviceTimer()
+{
+    if (tree_)
+    {
+        events_.stop();
+        TimerRegistry::pop_device(*tree_, node_, std::move(events_));
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
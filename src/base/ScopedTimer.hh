@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ScopedTimer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "Stopwatch.hh"
+#include "TimerRegistry.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Time a named scope, nested inside any timed scope that encloses it.
+ *
+ * The elapsed time and call count are accumulated into the current thread's
+ * call tree of a \c TimerRegistry (the global one by default) when the timer
+ * is destroyed. If the registry is disabled at construction, the timer does
+ * nothing.
+ *
+ * \code
+    {
+        ScopedTimer time_scope("transport");
+        // ...
+    }
+   \endcode
+ */
+class ScopedTimer
+{
+  public:
+    // Start timing a scope in the global registry
+    explicit inline ScopedTimer(const char* name);
+
+    // Start timing a scope in the given registry
+    inline ScopedTimer(const char* name, TimerRegistry& registry);
+
+    // Accumulate elapsed time
+    inline ~ScopedTimer();
+
+    //!@{
+    //! Prevent copying and moving
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    //!@}
+
+  private:
+    TimerRegistry::ThreadTree* tree_{nullptr};
+    TimerRegistry::NodeId      node_{0};
+    Stopwatch                  get_elapsed_time_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing a scope in the global registry.
+ */
+ScopedTimer::ScopedTimer(const char* name)
+    : ScopedTimer(name, TimerRegistry::global())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing a scope in the given registry.
+ */
+ScopedTimer::ScopedTimer(const char* name, TimerRegistry& registry)
+{
+    if (registry.enabled())
+    {
+        tree_             = &registry.thread_tree();
+        node_             = TimerRegistry::push(*tree_, name);
+        get_elapsed_time_ = {};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate elapsed time.
+ */
+ScopedTimer::~ScopedTimer()
+{
+    if (tree_)
+    {
+        TimerRegistry::pop(*tree_, node_, get_elapsed_time_());
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SlabAllocatorPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "Macros.hh"
+#include "StackAllocatorPointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Contiguous block of stack storage reserved by a single worker.
+ *
+ * Values in [begin, begin + size) are in use; the remainder up to \c capacity
+ * is unused and is removed during compaction.
+ */
+struct StackSlab
+{
+    using size_type = ull_int;
+
+    size_type begin{0};    //!< Offset of the first value in the stack
+    size_type size{0};     //!< Number of values allocated by the owner
+    size_type capacity{0}; //!< Number of values reserved
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Pointers to slab allocator data.
+ *
+ * Values are stored in an ordinary stack allocation; each reservation of a
+ * slab from that stack is recorded in a second stack so that the unused
+ * slab tails can be compacted away.
+ */
+template<class T>
+struct SlabAllocatorPointers
+{
+    //!@{
+    //! Type aliases
+    using size_type  = ull_int;
+    using value_type = T;
+    //!@}
+
+    StackAllocatorPointers<T>         items;         //!< Value storage
+    StackAllocatorPointers<StackSlab> slabs;         //!< Slab records
+    size_type                         slab_size = 0; //!< Values per slab
+
+    //! Whether the interface is initialized
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return items && slabs && slab_size > 0;
+    }
+
+    //! Total capacity of stack
+    CELER_FUNCTION size_type capacity() const { return items.capacity(); }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
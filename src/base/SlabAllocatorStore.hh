@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SlabAllocatorStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "SlabAllocatorPointers.hh"
+#include "StackAllocatorStore.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Manage data for a slab allocation of a particular type.
+ *
+ * This pairs a stack allocation of values with a stack of slab records (see
+ * \c SlabAllocatorView). Between kernels, \c compact removes the unused slab
+ * tails so that the allocated values are contiguous at the start of the
+ * stack, with the same layout as if a \c StackAllocatorView had been used.
+ *
+ * The maximum number of slab records defaults to enough for the value
+ * storage to be filled by slabs that are half full.
+ */
+template<class T>
+class SlabAllocatorStore
+{
+  public:
+    //!@{
+    //! Type aliases
+    using value_type = T;
+    using size_type  = ull_int;
+    using Pointers   = SlabAllocatorPointers<T>;
+    //!@}
+
+  public:
+    // Construct with no storage
+    SlabAllocatorStore() = default;
+
+    // Construct with the number of values and values per slab
+    SlabAllocatorStore(size_type capacity, size_type slab_size);
+
+    // Construct with the number of values and slabs in a memory space
+    SlabAllocatorStore(size_type capacity,
+                       size_type slab_size,
+                       size_type max_slabs,
+                       MemSpace  space);
+
+    //// HOST ACCESSORS ////
+
+    //! Size of the allocation
+    size_type capacity() const { return items_.capacity(); }
+
+    //! Number of values reserved per slab
+    size_type slab_size() const { return slab_size_; }
+
+    //! Maximum number of slabs reserved between compactions
+    size_type max_slabs() const { return slabs_.capacity(); }
+
+    // Get the stack size, including any gaps, via a device->host copy
+    size_type get_size();
+
+    // Get the number of values that failed to allocate
+    size_type get_overflow();
+
+    // Remove gaps between slabs, returning the number of stored values
+    size_type compact();
+
+    // Clear allocated data and slabs
+    void clear();
+
+    //// DEVICE ACCESSORS ////
+
+    // Get a view to the managed data
+    Pointers device_pointers();
+
+  private:
+    StackAllocatorStore<value_type> items_;
+    StackAllocatorStore<StackSlab>  slabs_;
+    size_type                       slab_size_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
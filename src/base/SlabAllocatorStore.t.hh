@@ -0,0 +1,165 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SlabAllocatorStore.t.hh
+//---------------------------------------------------------------------------//
+#include "SlabAllocatorStore.hh"
+
+#include <algorithm>
+#include <vector>
+#include "Assert.hh"
+#include "StackAllocatorStore.t.hh"
+#include "comm/Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of values and values per slab.
+ */
+template<class T>
+SlabAllocatorStore<T>::SlabAllocatorStore(size_type capacity,
+                                          size_type slab_size)
+    : SlabAllocatorStore(capacity,
+                         slab_size,
+                         2 * ((capacity + slab_size - 1) / slab_size),
+                         is_device_enabled() ? MemSpace::device
+                                             : MemSpace::host)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of values and slabs in a memory space.
+ */
+template<class T>
+SlabAllocatorStore<T>::SlabAllocatorStore(size_type capacity,
+                                          size_type slab_size,
+                                          size_type max_slabs,
+                                          MemSpace  space)
+    : items_(capacity, space), slabs_(max_slabs, space), slab_size_(slab_size)
+{
+    CELER_EXPECT(capacity > 0);
+    CELER_EXPECT(slab_size > 0);
+    CELER_EXPECT(max_slabs > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get pointers for the managed data.
+ */
+template<class T>
+auto SlabAllocatorStore<T>::device_pointers() -> Pointers
+{
+    Pointers ptrs;
+    ptrs.items     = items_.device_pointers();
+    ptrs.slabs     = slabs_.device_pointers();
+    ptrs.slab_size = slab_size_;
+    return ptrs;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the stack size via a device->host copy.
+ *
+ * Before compaction this includes any unused slab tails.
+ */
+template<class T>
+auto SlabAllocatorStore<T>::get_size() -> size_type
+{
+    return items_.get_size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of values that failed to allocate via a device->host copy.
+ */
+template<class T>
+auto SlabAllocatorStore<T>::get_overflow() -> size_type
+{
+    return items_.get_overflow();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove gaps between slabs.
+ *
+ * The used values of each slab are moved (preserving the order of the
+ * slabs in the stack) to the front of the stack, and the slab records are
+ * cleared. This must not be called while any kernel is allocating; pointers
+ * previously returned by the allocator are invalidated.
+ */
+template<class T>
+auto SlabAllocatorStore<T>::compact() -> size_type
+{
+    CELER_EXPECT(slab_size_ > 0);
+
+    // Copy the used slab records to host and sort by position in the stack
+    std::vector<StackSlab> slabs(
+        std::min<size_type>(slabs_.get_size(), slabs_.capacity()));
+    slabs_.copy_to_host(make_span(slabs));
+    std::sort(slabs.begin(),
+              slabs.end(),
+              [](const StackSlab& a, const StackSlab& b) {
+                  return a.begin < b.begin;
+              });
+
+    // Get host-accessible values, copying only the reserved part of the stack
+    std::vector<value_type> host_items;
+    Span<value_type>        items;
+    if (items_.memspace() == MemSpace::host)
+    {
+        items = items_.device_pointers().storage;
+    }
+    else
+    {
+        host_items.resize(
+            std::min<size_type>(items_.get_size(), items_.capacity()));
+        items_.copy_to_host(make_span(host_items));
+        items = make_span(host_items);
+    }
+
+    // Move used values toward the front of the stack
+    size_type size = 0;
+    for (const StackSlab& slab : slabs)
+    {
+        if (slab.size == 0)
+        {
+            continue;
+        }
+        CELER_ASSERT(slab.begin >= size);
+        CELER_ASSERT(slab.begin + slab.size <= items.size());
+        if (slab.begin != size)
+        {
+            std::copy(items.begin() + slab.begin,
+                      items.begin() + slab.begin + slab.size,
+                      items.begin() + size);
+        }
+        size += slab.size;
+    }
+
+    if (!host_items.empty())
+    {
+        // Only the compacted values need to be copied back
+        items_.copy_to_device({host_items.data(), size});
+    }
+    items_.set_size(size);
+    slabs_.clear();
+    return size;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Clear allocated data and slabs.
+ */
+template<class T>
+void SlabAllocatorStore<T>::clear()
+{
+    items_.clear();
+    slabs_.clear();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,92 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SlabAllocatorView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "SlabAllocatorPointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate stack data through a worker-local slab.
+ *
+ * Every call to a \c StackAllocatorView performs an atomic add on the single
+ * shared size, which becomes heavily contended when many threads allocate
+ * small amounts of data. This view instead reserves a slab of \c slab_size
+ * values from the shared stack with a single atomic operation and then
+ * sub-allocates from it without synchronization. When the slab is exhausted
+ * or the view is released, the unused tail of the slab is returned to the
+ * stack if no other slab has been reserved after it.
+ *
+ * A view must be owned by a single worker (a host thread or a device thread)
+ * and should be kept alive across all that worker's allocations in a kernel,
+ * e.g. for a chunk of tracks:
+ * \code
+    pool.parallel_for(num_tracks, 64, [&](size_type begin, size_type end) {
+        SlabAllocatorView<Secondary> allocate(ptrs);
+        for (auto i : range(begin, end))
+        {
+            Secondary* secondaries = allocate(2);
+            // ...
+        }
+    });
+    store.compact();
+   \endcode
+ *
+ * Unreturned slab tails leave gaps in the stack, so the allocated data are
+ * only contiguous after \c SlabAllocatorStore::compact is called between
+ * kernels. After compaction, a \c StackAllocatorView constructed from \c
+ * items provides the usual \c get() view of all allocated values.
+ */
+template<class T>
+class SlabAllocatorView
+{
+  public:
+    //!@{
+    //! Type aliases
+    using value_type  = T;
+    using size_type   = ull_int;
+    using result_type = value_type*;
+    using Pointers    = SlabAllocatorPointers<T>;
+    //!@}
+
+  public:
+    // Construct with shared data
+    explicit inline CELER_FUNCTION SlabAllocatorView(const Pointers& shared);
+
+    // Return the unused tail of the current slab
+    inline CELER_FUNCTION ~SlabAllocatorView();
+
+    //!@{
+    //! Prevent copying: the current slab is owned by this view
+    SlabAllocatorView(const SlabAllocatorView&) = delete;
+    SlabAllocatorView& operator=(const SlabAllocatorView&) = delete;
+    //!@}
+
+    // Allocate space for this many data
+    inline CELER_FUNCTION result_type operator()(size_type count);
+
+    // Return the unused tail of the current slab
+    inline CELER_FUNCTION void release();
+
+    // Total storage capacity
+    inline CELER_FUNCTION size_type capacity() const;
+
+  private:
+    const Pointers& shared_;
+    StackSlab*      slab_ = nullptr;
+
+    // Reserve a new slab that can hold at least this many values
+    inline CELER_FUNCTION StackSlab* reserve(size_type count);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "SlabAllocatorView.i.hh"
@@ -0,0 +1,148 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SlabAllocatorView.i.hh
+//---------------------------------------------------------------------------//
+#include "Algorithms.hh"
+#include "Atomics.hh"
+#include "StackAllocatorView.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared data.
+ */
+template<class T>
+CELER_FUNCTION SlabAllocatorView<T>::SlabAllocatorView(const Pointers& shared)
+    : shared_(shared)
+{
+    CELER_EXPECT(shared);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return the unused tail of the current slab.
+ */
+template<class T>
+CELER_FUNCTION SlabAllocatorView<T>::~SlabAllocatorView()
+{
+    this->release();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate space for a given number of items.
+ *
+ * Returns NULL if allocation failed due to out-of-memory. Values are
+ * default-initialized when their slab is reserved.
+ */
+template<class T>
+CELER_FUNCTION auto SlabAllocatorView<T>::operator()(size_type count)
+    -> result_type
+{
+    CELER_EXPECT(count > 0);
+
+    if (!slab_ || slab_->size + count > slab_->capacity)
+    {
+        // Current slab is exhausted: reserve a new one
+        this->release();
+        slab_ = this->reserve(count);
+        if (CELER_UNLIKELY(!slab_))
+        {
+            return nullptr;
+        }
+    }
+
+    value_type* result
+        = shared_.items.storage.data() + slab_->begin + slab_->size;
+    slab_->size += count;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return the unused tail of the current slab.
+ *
+ * If the slab is still at the top of the stack, the shared size is reduced
+ * to the end of the used values. Otherwise the tail remains a gap until the
+ * stack is compacted.
+ */
+template<class T>
+CELER_FUNCTION void SlabAllocatorView<T>::release()
+{
+    if (!slab_)
+    {
+        return;
+    }
+
+    if (slab_->size < slab_->capacity)
+    {
+        size_type end      = slab_->begin + slab_->capacity;
+        size_type used_end = slab_->begin + slab_->size;
+        if (atomic_cas(shared_.items.size, end, used_end) == end)
+        {
+            slab_->capacity = slab_->size;
+        }
+    }
+    slab_ = nullptr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the maximum number of values that can be allocated.
+ */
+template<class T>
+CELER_FUNCTION auto SlabAllocatorView<T>::capacity() const -> size_type
+{
+    return shared_.items.storage.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reserve a new slab that can hold at least this many values.
+ *
+ * If a full slab no longer fits, fall back to reserving exactly the requested
+ * number of values so that the stack can be filled to capacity; only a
+ * failure of the latter is recorded in the overflow status. A slab record
+ * whose value reservation fails is left with zero capacity.
+ */
+template<class T>
+CELER_FUNCTION StackSlab* SlabAllocatorView<T>::reserve(size_type count)
+{
+    StackAllocatorView<StackSlab> allocate_slab(shared_.slabs);
+    StackSlab*                    slab = allocate_slab(1);
+    if (CELER_UNLIKELY(!slab))
+    {
+        return nullptr;
+    }
+
+    size_type   num_reserved = celeritas::max(count, shared_.slab_size);
+    value_type* items        = nullptr;
+    if (num_reserved > count)
+    {
+        // Try a full slab without reporting a failure as an overflow
+        StackAllocatorPointers<value_type> items_ptrs = shared_.items;
+        items_ptrs.overflow                           = nullptr;
+        items = StackAllocatorView<value_type>(items_ptrs)(num_reserved);
+    }
+    if (!items)
+    {
+        num_reserved = count;
+        items = StackAllocatorView<value_type>(shared_.items)(num_reserved);
+    }
+    if (CELER_UNLIKELY(!items))
+    {
+        return nullptr;
+    }
+
+    slab->begin    = items - shared_.items.storage.data();
+    slab->size     = 0;
+    slab->capacity = num_reserved;
+    return slab;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
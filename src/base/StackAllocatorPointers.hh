@@ -16,6 +16,11 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Pointers to stack allocator data.
+ *
+ * The optional \c overflow status word accumulates the number of values
+ * whose allocation failed because the stack was full. A nonzero value after a
+ * kernel indicates that some allocations (and the interactions that made them)
+ * must be retried, and it gives the additional capacity required.
  */
 template<class T>
 struct StackAllocatorPointers
@@ -26,8 +31,9 @@ struct StackAllocatorPointers
     using value_type = T;
     //!@}
 
-    Span<T>    storage;        //!< Allocated capacity
-    size_type* size = nullptr; //!< Stored size
+    Span<T>    storage;            //!< Allocated capacity
+    size_type* size     = nullptr; //!< Stored size
+    size_type* overflow = nullptr; //!< Failed allocations (optional)
 
     // Whether the interface is initialized
     explicit inline CELER_FUNCTION operator bool() const;
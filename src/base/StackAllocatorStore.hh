@@ -18,7 +18,23 @@ namespace celeritas
  * Manage device data for an allocation of a particular type.
  *
  * The capacity is known by the host, but the data and size are both stored on
- * device.
+ * device (or in host memory if no device is available).
+ *
+ * Allocations that fail because the stack is full are counted in an overflow
+ * status word. The store can optionally reserve an overflow arena beyond the
+ * initial capacity: after a kernel runs out of memory, \c grow extends the
+ * capacity into the arena without moving the existing data, and the failed
+ * work can be rerun. The stack then only needs to be sized for typical steps
+ * rather than the worst case.
+ * \code
+    StackAllocatorStore<Secondary> secondaries(1024, 16 * 1024, space);
+    launch_interact(secondaries.device_pointers());
+    if (secondaries.get_overflow() > 0 && secondaries.grow())
+    {
+        // Rerun failed interactions with the new pointers
+        launch_interact(secondaries.device_pointers());
+    }
+   \endcode
  */
 template<class T>
 class StackAllocatorStore
@@ -38,17 +54,46 @@ class StackAllocatorStore
     // Construct with the maximum number of values to store on device
     explicit StackAllocatorStore(size_type capacity);
 
+    // Construct with the maximum number of values in a given memory space
+    StackAllocatorStore(size_type capacity, MemSpace space);
+
+    // Construct with an initial capacity and additional overflow arena
+    StackAllocatorStore(size_type capacity,
+                        size_type overflow_capacity,
+                        MemSpace  space);
+
     //// HOST ACCESSORS ////
 
-    //! Size of the allocation
+    //! Number of values that can currently be allocated
     size_type capacity() const { return allocation_.size(); }
 
+    //! Capacity including the full overflow arena
+    size_type max_capacity() const { return allocation_.capacity(); }
+
+    //! Memory space of the stored data
+    MemSpace memspace() const { return allocation_.memspace(); }
+
     // Get the actual size via a device->host copy
     size_type get_size();
 
-    // Clear allocated data (performs kernel launch!)
+    // Set the allocated size (performs a host->device copy)
+    void set_size(size_type size);
+
+    // Get the number of values that failed to allocate
+    size_type get_overflow();
+
+    // Extend the capacity into the overflow arena after running out of memory
+    bool grow();
+
+    // Clear allocated data and overflow status (performs a host->device copy)
     void clear();
 
+    // Copy the leading values to host
+    void copy_to_host(Span<value_type> host_data) const;
+
+    // Copy the leading values from host
+    void copy_to_device(Span<const value_type> host_data);
+
     //// DEVICE ACCESSORS ////
 
     // Get a view to the managed data
@@ -57,6 +102,7 @@ class StackAllocatorStore
   private:
     DeviceVector<value_type> allocation_;
     DeviceVector<size_type>  size_allocation_;
+    DeviceVector<size_type>  overflow_allocation_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,8 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "StackAllocatorStore.hh"
 
+#include <algorithm>
 #include "Assert.hh"
-#include "Memory.hh"
 
 namespace celeritas
 {
@@ -18,13 +18,45 @@ namespace celeritas
  */
 template<class T>
 StackAllocatorStore<T>::StackAllocatorStore(size_type capacity)
-    : allocation_(capacity), size_allocation_(1)
+    : allocation_(capacity), size_allocation_(1), overflow_allocation_(1)
 {
     CELER_EXPECT(capacity > 0);
     this->clear();
     CELER_ENSURE(this->get_size() == 0);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of values to allocate in a given memory space.
+ */
+template<class T>
+StackAllocatorStore<T>::StackAllocatorStore(size_type capacity, MemSpace space)
+    : StackAllocatorStore(capacity, 0, space)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with an initial capacity and additional overflow arena.
+ *
+ * The full arena is allocated up front, but only \c capacity values are
+ * visible to the allocator until \c grow is called.
+ */
+template<class T>
+StackAllocatorStore<T>::StackAllocatorStore(size_type capacity,
+                                            size_type overflow_capacity,
+                                            MemSpace  space)
+    : allocation_(capacity + overflow_capacity, space)
+    , size_allocation_(1, space)
+    , overflow_allocation_(1, space)
+{
+    CELER_EXPECT(capacity > 0);
+    allocation_.resize(capacity);
+    this->clear();
+    CELER_ENSURE(this->get_size() == 0);
+    CELER_ENSURE(this->max_capacity() == capacity + overflow_capacity);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get device pointers for the managed data.
@@ -35,7 +67,8 @@ auto StackAllocatorStore<T>::device_pointers() -> Pointers
     CELER_EXPECT(!allocation_.empty());
     Pointers ptrs;
     ptrs.storage = allocation_.device_pointers();
-    ptrs.size    = size_allocation_.device_pointers().data();
+    ptrs.size     = size_allocation_.device_pointers().data();
+    ptrs.overflow = overflow_allocation_.device_pointers().data();
     return ptrs;
 }
 
@@ -43,14 +76,101 @@ auto StackAllocatorStore<T>::device_pointers() -> Pointers
 /*!
  * Clear allocated data.
  *
- * This executes a kernel launch which simply resets the allocated size to
- * zero. It does not change the allocation itself.
+ * This copies a zero into the allocated size and overflow status, which works
+ * for both host and device memory. It does not change the allocation itself.
  */
 template<class T>
 void StackAllocatorStore<T>::clear()
+{
+    CELER_EXPECT(!overflow_allocation_.empty());
+    this->set_size(0);
+    const size_type zero = 0;
+    overflow_allocation_.copy_to_device({&zero, 1});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the allocated size.
+ *
+ * This should only be used after the data has been rearranged on the host,
+ * e.g. by compaction, and must not be called while a kernel is allocating.
+ */
+template<class T>
+void StackAllocatorStore<T>::set_size(size_type size)
 {
     CELER_EXPECT(!size_allocation_.empty());
-    device_memset_zero(size_allocation_.device_pointers());
+    CELER_EXPECT(size <= this->capacity());
+    size_allocation_.copy_to_device({&size, 1});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of values that failed to allocate since the last clear.
+ *
+ * A nonzero result means that at least one allocation returned a null
+ * pointer. This performs a device->host copy.
+ */
+template<class T>
+auto StackAllocatorStore<T>::get_overflow() -> size_type
+{
+    CELER_EXPECT(!overflow_allocation_.empty());
+    size_type result;
+    overflow_allocation_.copy_to_host({&result, 1});
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Extend the capacity into the overflow arena after running out of memory.
+ *
+ * The capacity is at least doubled (to amortize reruns of bursty steps) and
+ * increased enough to hold all the failed allocations, up to the maximum
+ * capacity. The overflow status is then reset. Allocated data are not moved,
+ * but the pointers must be reacquired since their capacity has changed.
+ *
+ * \return Whether the new capacity can hold all the failed allocations
+ */
+template<class T>
+bool StackAllocatorStore<T>::grow()
+{
+    size_type overflow = this->get_overflow();
+    if (overflow == 0)
+    {
+        return true;
+    }
+
+    size_type required     = this->get_size() + overflow;
+    size_type new_capacity = std::min(
+        std::max(required, 2 * this->capacity()), this->max_capacity());
+    allocation_.resize(new_capacity);
+
+    const size_type zero = 0;
+    overflow_allocation_.copy_to_device({&zero, 1});
+    return required <= new_capacity;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the leading values to host.
+ *
+ * Pass a span of \c get_size() elements to copy only the allocated values.
+ */
+template<class T>
+void StackAllocatorStore<T>::copy_to_host(Span<value_type> host_data) const
+{
+    CELER_EXPECT(host_data.size() <= this->capacity());
+    allocation_.copy_to_host(host_data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the leading values from host.
+ */
+template<class T>
+void StackAllocatorStore<T>::copy_to_device(Span<const value_type> host_data)
+{
+    CELER_EXPECT(host_data.size() <= this->capacity());
+    allocation_.copy_to_device(host_data);
 }
 
 //---------------------------------------------------------------------------//
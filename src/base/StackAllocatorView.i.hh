@@ -27,7 +27,10 @@ CELER_FUNCTION StackAllocatorView<T>::StackAllocatorView(const Pointers& shared)
  * Allocate space for a given number of itemss.
  *
  * Returns NULL if allocation failed due to out-of-memory. Ensures that the
- * shared size reflects the amount of data allocated
+ * shared size reflects the amount of data allocated. If the shared data has an
+ * overflow status word, the failed count is added to it so that the host can
+ * detect the failure (and the capacity needed to recover from it) without
+ * looping over the interactions.
  */
 template<class T>
 CELER_FUNCTION auto StackAllocatorView<T>::operator()(size_type count)
@@ -56,9 +59,11 @@ CELER_FUNCTION auto StackAllocatorView<T>::operator()(size_type count)
             *shared_.size = start;
         }
 
-        // TODO It might be useful to set an "out of memory" flag to make it
-        // easier for host code to detect whether a failure occurred, rather
-        // than looping through primaries and testing for failure.
+        if (shared_.overflow)
+        {
+            // Record the out-of-memory condition
+            atomic_add(shared_.overflow, count);
+        }
 
         // Return null pointer, indicating failure to allocate.
         return nullptr;
@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StateCollection.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "Assert.hh"
+#include "Macros.hh"
+#include "Types.hh"
+#include "detail/StateCollectionImpl.hh"
+
+namespace celeritas
+{
+namespace layout
+{
+//---------------------------------------------------------------------------//
+//! Array of structures: all fields of a track are adjacent in memory
+struct AoS
+{
+};
+
+//! Structure of arrays: each field is a separate contiguous array
+struct SoA
+{
+};
+
+//! Array of structures of arrays: fields are interleaved in blocks of W
+template<size_type W>
+struct AoSoA
+{
+    static constexpr size_type width = W;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace layout
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reference to per-track state data with a compile-time memory layout.
+ *
+ * The fields of the state are given by the template parameter pack and are
+ * accessed by index, so the layout can be changed (for benchmarking on a
+ * particular architecture) without changing the code that uses it. Track
+ * views should use named indices for readability:
+ * \code
+    struct SimFields { enum : size_type { track_id, alive }; };
+    using SimCollection = StateCollection<layout::SoA, TrackId, bool>;
+
+    bool& alive = states.get<SimFields::alive>(tid);
+   \endcode
+ *
+ * Fields must be trivially copyable; the underlying memory is owned by a \c
+ * StateCollectionStore. Fields that are always accessed together should be
+ * grouped into a single \c AoS collection, and independent hot fields can be
+ * split into separate \c SoA collections.
+ */
+template<class L, class... Ts>
+class StateCollection
+{
+    using Traits = detail::StateLayoutTraits<L, Ts...>;
+
+  public:
+    //!@{
+    //! Type aliases
+    using layout_type  = L;
+    using storage_type = typename Traits::storage_type;
+    template<size_type I>
+    using value_type = typename detail::FieldGetter<I, Ts...>::type;
+    //!@}
+
+  public:
+    //! Number of fields per track
+    static CELER_CONSTEXPR_FUNCTION size_type num_fields()
+    {
+        return sizeof...(Ts);
+    }
+
+    //! Construct with no data
+    StateCollection() = default;
+
+    //! Construct from layout-specific storage (used by StateCollectionStore)
+    CELER_FUNCTION StateCollection(storage_type storage, size_type size)
+        : storage_(storage), size_(size)
+    {
+    }
+
+    //! Whether the collection is assigned
+    explicit CELER_FUNCTION operator bool() const { return size_ != 0; }
+
+    //! Whether the collection is empty
+    CELER_FUNCTION bool empty() const { return size_ == 0; }
+
+    //! Number of track states
+    CELER_FUNCTION size_type size() const { return size_; }
+
+    //! Access a single field of a track state
+    template<size_type I>
+    CELER_FORCEINLINE_FUNCTION value_type<I>& get(ThreadId tid) const
+    {
+        CELER_EXPECT(tid < size_);
+        return Traits::template get<I>(storage_, tid.get());
+    }
+
+  private:
+    storage_type storage_{};
+    size_type    size_{0};
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StateCollectionStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "DeviceAllocation.hh"
+#include "StateCollection.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Manage device data for a collection of track states.
+ *
+ * All fields are stored in a single allocation whose arrangement is set by
+ * the layout of the collection. The data is uninitialized on construction.
+ * \code
+    StateCollectionStore<ParticleStatePointers::Collection> store(num_tracks);
+    ParticleStatePointers::Collection vars = store.device_pointers();
+   \endcode
+ */
+template<class C>
+class StateCollectionStore;
+
+template<class L, class... Ts>
+class StateCollectionStore<StateCollection<L, Ts...>>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Pointers = StateCollection<L, Ts...>;
+    //!@}
+
+  public:
+    // Construct with no storage
+    StateCollectionStore() = default;
+
+    // Construct with the number of track states to store on device
+    explicit StateCollectionStore(size_type size);
+
+    // Construct with the number of track states in a given memory space
+    StateCollectionStore(size_type size, MemSpace space);
+
+    //// HOST ACCESSORS ////
+
+    //! Number of track states
+    size_type size() const { return size_; }
+
+    //! Memory space of the stored data
+    MemSpace memspace() const { return allocation_.memspace(); }
+
+    //! Total number of bytes allocated, including padding
+    size_type num_bytes() const { return allocation_.size(); }
+
+    //// DEVICE ACCESSORS ////
+
+    // Get a view to the managed data
+    Pointers device_pointers();
+
+  private:
+    DeviceAllocation allocation_;
+    size_type        size_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
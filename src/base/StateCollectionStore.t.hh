@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StateCollectionStore.t.hh
+//---------------------------------------------------------------------------//
+#include "StateCollectionStore.hh"
+
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of track states to allocate on device.
+ */
+template<class L, class... Ts>
+StateCollectionStore<StateCollection<L, Ts...>>::StateCollectionStore(
+    size_type size)
+    : allocation_(detail::StateLayoutTraits<L, Ts...>::num_bytes(size))
+    , size_(size)
+{
+    CELER_EXPECT(size > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of track states in a given memory space.
+ */
+template<class L, class... Ts>
+StateCollectionStore<StateCollection<L, Ts...>>::StateCollectionStore(
+    size_type size, MemSpace space)
+    : allocation_(detail::StateLayoutTraits<L, Ts...>::num_bytes(size), space)
+    , size_(size)
+{
+    CELER_EXPECT(size > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a view to the managed data.
+ */
+template<class L, class... Ts>
+auto StateCollectionStore<StateCollection<L, Ts...>>::device_pointers()
+    -> Pointers
+{
+    using Traits = detail::StateLayoutTraits<L, Ts...>;
+    CELER_EXPECT(size_ > 0);
+
+    Pointers result(Traits::build(allocation_.device_pointers().data(), size_),
+                    size_);
+    CELER_ENSURE(result.size() == size_);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,422 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ThreadPool.cc
+//---------------------------------------------------------------------------//
+#include "ThreadPool.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include "Assert.hh"
+#include "Range.hh"
+#include "Stopwatch.hh"
+#include "comm/Logger.hh"
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// Index of the pool worker running on this thread
+thread_local celeritas::size_type t_worker_index = 0;
+
+// Whether this thread is executing a loop body
+thread_local bool t_in_loop = false;
+
+//---------------------------------------------------------------------------//
+// Mark the current thread as executing a loop body
+class ScopedInLoop
+{
+  public:
+    ScopedInLoop() : prev_(t_in_loop) { t_in_loop = true; }
+    ~ScopedInLoop() { t_in_loop = prev_; }
+
+  private:
+    bool prev_;
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+celeritas::size_type determine_num_threads()
+{
+    const char* env_threads = std::getenv("CELER_NUM_THREADS");
+    if (env_threads && env_threads[0] != '\0')
+    {
+        int result = std::atoi(env_threads);
+        CELER_VALIDATE(result > 0,
+                       "Invalid CELER_NUM_THREADS value '" << env_threads
+                                                           << "'");
+        return result;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+//---------------------------------------------------------------------------//
+} // namespace
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the total number of threads, including the caller.
+ */
+ThreadPool::ThreadPool(size_type num_threads)
+{
+    CELER_EXPECT(num_threads > 0);
+    workers_.reserve(num_threads);
+    for (CELER_MAYBE_UNUSED auto i : range(num_threads))
+    {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+
+    threads_.reserve(num_threads - 1);
+    for (auto i : range<size_type>(1, num_threads))
+    {
+        threads_.emplace_back([this, i] { this->worker_loop(i); });
+    }
+    CELER_ENSURE(this->num_threads() == num_threads);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop and join all workers.
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& t : threads_)
+    {
+        t.join();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Call a function over chunks of [0, count).
+ *
+ * Each chunk passed to the function has at most \c grain_size elements. A
+ * smaller grain size improves load balancing at the cost of more scheduling
+ * overhead; the returned statistics can be used to tune it.
+ */
+auto ThreadPool::parallel_for(size_type            count,
+                              size_type            grain_size,
+                              const ChunkFunction& func) -> Stats
+{
+    CELER_EXPECT(grain_size > 0);
+    CELER_EXPECT(func);
+
+    Stats result;
+    if (count == 0)
+    {
+        return result;
+    }
+
+    if (t_in_loop)
+    {
+        // Nested call from a loop body: run serially on this thread without
+        // touching the pool's state
+        func(0, count);
+        result.num_tasks = 1;
+        return result;
+    }
+
+    if (threads_.empty() || count <= grain_size)
+    {
+        // Run serially on the calling thread
+        {
+            ScopedInLoop in_loop;
+            func(0, count);
+        }
+        result.num_tasks = 1;
+        std::lock_guard<std::mutex> launch_lock(launch_mutex_);
+        workers_.front()->accum_stats += result;
+        return result;
+    }
+
+    std::lock_guard<std::mutex> launch_lock(launch_mutex_);
+
+    // Divide the range evenly among the workers
+    for (auto i : range(this->num_threads()))
+    {
+        Worker&   w     = *workers_[i];
+        size_type begin = (count * i) / this->num_threads();
+        size_type end   = (count * (i + 1)) / this->num_threads();
+        if (begin != end)
+        {
+            w.tasks.push(range(begin, end));
+        }
+        w.stats = {};
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        func_            = &func;
+        grain_size_      = grain_size;
+        exception_       = nullptr;
+        pending_workers_ = threads_.size();
+        remaining_.store(count, std::memory_order_relaxed);
+        cancelled_.store(false, std::memory_order_relaxed);
+        ++generation_;
+    }
+    start_cv_.notify_all();
+
+    {
+        ScopedInLoop in_loop;
+        this->run_tasks(0);
+    }
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_workers_ == 0; });
+        func_ = nullptr;
+        std::swap(exception, exception_);
+    }
+
+    for (auto& w : workers_)
+    {
+        result += w->stats;
+        w->accum_stats += w->stats;
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulated statistics for each worker.
+ */
+auto ThreadPool::worker_stats() const -> std::vector<Stats>
+{
+    std::lock_guard<std::mutex> launch_lock(launch_mutex_);
+    std::vector<Stats>          result;
+    result.reserve(workers_.size());
+    for (const auto& w : workers_)
+    {
+        result.push_back(w->accum_stats);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Clear accumulated statistics.
+ */
+void ThreadPool::reset_stats()
+{
+    std::lock_guard<std::mutex> launch_lock(launch_mutex_);
+    for (auto& w : workers_)
+    {
+        w->accum_stats = {};
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Index of the worker executing the current loop body.
+ *
+ * This can be used inside a \c parallel_for body to access per-thread
+ * scratch storage. The calling thread has index zero.
+ */
+size_type ThreadPool::worker_index()
+{
+    return t_worker_index;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a shared pool.
+ *
+ * The number of threads is given by the \c CELER_NUM_THREADS environment
+ * variable if present, or by the hardware concurrency otherwise.
+ */
+auto ThreadPool::global() -> const SPThreadPool&
+{
+    static const SPThreadPool result = [] {
+        size_type num_threads = determine_num_threads();
+        CELER_LOG(debug) << "Creating host thread pool with " << num_threads
+                         << " threads";
+        return std::make_shared<ThreadPool>(num_threads);
+    }();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for jobs and process them until shutdown.
+ */
+void ThreadPool::worker_loop(size_type index)
+{
+    t_worker_index            = index;
+    t_in_loop                 = true;
+    size_type seen_generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [this, seen_generation] {
+                return shutdown_ || generation_ != seen_generation;
+            });
+            if (shutdown_)
+            {
+                return;
+            }
+            seen_generation = generation_;
+        }
+
+        this->run_tasks(index);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--pending_workers_ == 0)
+        {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute local and stolen tasks until the loop is complete.
+ */
+void ThreadPool::run_tasks(size_type index)
+{
+    Worker&            self = *workers_[index];
+    detail::IndexRange task;
+    while (true)
+    {
+        if (self.tasks.pop(&task))
+        {
+            this->execute(index, task);
+            continue;
+        }
+
+        Stopwatch get_idle_time;
+        bool      found = this->steal_task(index, &task);
+        self.stats.idle_time += get_idle_time();
+        if (!found)
+        {
+            // All indices have been processed
+            return;
+        }
+        ++self.stats.num_steals;
+        this->execute(index, task);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take a task from another worker, returning false if the loop is done.
+ *
+ * Victims are polled round-robin starting from the next worker. Since tasks
+ * are only removed from deques when they are about to be executed, work may
+ * remain outstanding while all deques are empty, because the executing
+ * threads may split their tasks further. In that case, sleep until another
+ * worker publishes new tasks or the loop completes.
+ */
+bool ThreadPool::steal_task(size_type index, detail::IndexRange* task)
+{
+    Worker&         self        = *workers_[index];
+    const size_type num_workers = workers_.size();
+    while (true)
+    {
+        size_type epoch = work_epoch_.load();
+        if (remaining_.load() == 0)
+        {
+            return false;
+        }
+
+        for (auto offset : range<size_type>(1, num_workers))
+        {
+            Worker& victim = *workers_[(index + offset) % num_workers];
+            if (victim.tasks.steal(task))
+            {
+                return true;
+            }
+            ++self.stats.num_failed_steals;
+        }
+
+        // Wait for new tasks: registering as a sleeper before checking the
+        // epoch guarantees that a concurrent publisher sees us and notifies
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++num_sleeping_;
+        work_cv_.wait(lock, [this, epoch] {
+            return work_epoch_.load() != epoch || remaining_.load() == 0;
+        });
+        --num_sleeping_;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wake workers waiting for tasks.
+ *
+ * This is called after tasks are pushed or the loop completes.
+ */
+void ThreadPool::notify_work()
+{
+    ++work_epoch_;
+    if (num_sleeping_.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        work_cv_.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Split a task down to the grain size and execute it.
+ */
+void ThreadPool::execute(size_type index, detail::IndexRange task)
+{
+    Worker& self     = *workers_[index];
+    bool    did_push = false;
+    while (task.size() > grain_size_)
+    {
+        // Keep the lower half and make the upper half available to thieves
+        self.tasks.push(detail::split_upper(&task));
+        ++self.stats.num_splits;
+        did_push = true;
+    }
+    if (did_push)
+    {
+        this->notify_work();
+    }
+
+    if (!cancelled_.load(std::memory_order_relaxed))
+    {
+        try
+        {
+            (*func_)(*task.begin(), *task.end());
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!exception_)
+            {
+                exception_ = std::current_exception();
+            }
+            // Skip the loop body for remaining tasks
+            cancelled_.store(true, std::memory_order_relaxed);
+        }
+        ++self.stats.num_tasks;
+    }
+    if (remaining_.fetch_sub(task.size()) == task.size())
+    {
+        // Last task: wake idle workers so they can finish
+        this->notify_work();
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,172 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ThreadPool.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Types.hh"
+#include "detail/TaskDeque.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent pool of host threads for data-parallel loops.
+ *
+ * Worker threads are created once at construction and sleep between calls.
+ * The calling thread participates in the work as worker zero, so a pool with
+ * \c num_threads() equal to one runs everything serially without any
+ * synchronization.
+ *
+ * Loops are scheduled by work stealing. The index range is initially divided
+ * evenly among the threads, each of which has its own task deque. A thread
+ * takes the most recent task from its own deque and recursively splits it in
+ * half, pushing the upper halves back onto its deque, until the remaining
+ * range is no larger than the grain size; that range is then passed to the
+ * loop body. A thread whose deque is empty steals the oldest (largest) task
+ * from another thread. Uneven per-index costs are therefore balanced without
+ * a central work queue.
+ *
+ * \code
+    ThreadPool pool(8);
+    pool.parallel_for(num_tracks, 64, [&](size_type begin, size_type end) {
+        for (auto i : range(begin, end))
+            do_work(i);
+    });
+   \endcode
+ *
+ * Only one loop executes at a time; a \c parallel_for called from inside a
+ * loop body runs serially on the thread executing that body. The first
+ * exception thrown by a body is rethrown on the calling thread after all
+ * workers finish.
+ */
+class ThreadPool
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ChunkFunction = std::function<void(size_type, size_type)>;
+    using SPThreadPool  = std::shared_ptr<ThreadPool>;
+    //!@}
+
+    //! Scheduling statistics
+    struct Stats
+    {
+        size_type num_tasks{0};         //!< Ranges passed to the loop body
+        size_type num_splits{0};        //!< Ranges divided in half
+        size_type num_steals{0};        //!< Tasks taken from another thread
+        size_type num_failed_steals{0}; //!< Steal attempts on empty deques
+        real_type idle_time{0};         //!< Time spent looking for work [s]
+
+        // Accumulate statistics
+        inline Stats& operator+=(const Stats& other);
+    };
+
+  public:
+    // Construct with the total number of threads, including the caller
+    explicit ThreadPool(size_type num_threads);
+
+    // Stop and join all workers
+    ~ThreadPool();
+
+    //!@{
+    //! Prevent copying and moving: workers hold a pointer to this
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    //!@}
+
+    //! Total number of threads, including the calling thread
+    size_type num_threads() const { return workers_.size(); }
+
+    // Call a function over chunks of [0, count)
+    Stats parallel_for(size_type            count,
+                       size_type            grain_size,
+                       const ChunkFunction& func);
+
+    // Accumulated statistics for each worker
+    std::vector<Stats> worker_stats() const;
+
+    // Clear accumulated statistics
+    void reset_stats();
+
+    // Index of the worker executing the current loop body
+    static size_type worker_index();
+
+    // Shared pool sized by CELER_NUM_THREADS or the hardware concurrency
+    static const SPThreadPool& global();
+
+  private:
+    //// TYPES ////
+
+    struct Worker
+    {
+        detail::TaskDeque tasks;
+        Stats             stats;       // Current loop
+        Stats             accum_stats; // All loops
+    };
+
+    //// DATA ////
+
+    // Per-thread task queues: index 0 is the calling thread
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread>             threads_;
+
+    // Serialize parallel_for calls
+    mutable std::mutex launch_mutex_;
+
+    // Worker wakeup and completion
+    std::mutex              mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    std::condition_variable work_cv_;
+    size_type               generation_      = 0;
+    size_type               pending_workers_ = 0;
+    bool                    shutdown_        = false;
+
+    // Current job
+    const ChunkFunction*   func_       = nullptr;
+    size_type              grain_size_ = 0;
+    std::atomic<size_type> remaining_{0};
+    std::atomic<bool>      cancelled_{false};
+    std::atomic<size_type> work_epoch_{0};
+    std::atomic<size_type> num_sleeping_{0};
+    std::exception_ptr     exception_;
+
+    //// HELPER FUNCTIONS ////
+
+    void worker_loop(size_type index);
+    void run_tasks(size_type index);
+    bool steal_task(size_type index, detail::IndexRange* task);
+    void notify_work();
+    void execute(size_type index, detail::IndexRange task);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate statistics.
+ */
+auto ThreadPool::Stats::operator+=(const Stats& other) -> Stats&
+{
+    num_tasks += other.num_tasks;
+    num_splits += other.num_splits;
+    num_steals += other.num_steals;
+    num_failed_steals += other.num_failed_steals;
+    idle_time += other.idle_time;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,398 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TimerRegistry.cc
+//---------------------------------------------------------------------------//
+#include "TimerRegistry.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include "Assert.hh"
+#include "Macros.hh"
+#include "Range.hh"
+#include "detail/DeviceTimerEvents.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Call tree of a single thread.
+ *
+ * Nodes are stored in a flat vector and refer to each other by index, so
+ * adding a node never invalidates the parent links. Node zero is the root.
+ * Device events whose elapsed time has not yet been read are kept with their
+ * node until the results are merged, and are then kept for reuse. The mutex
+ * guards the nodes against concurrent merging by another thread.
+ */
+struct TimerRegistry::ThreadTree
+{
+    struct Node
+    {
+        const char*                            name;
+        NodeId                                 parent;
+        std::vector<NodeId>                    children;
+        size_type                              count{0};
+        real_type                              time{0};
+        std::vector<detail::DeviceTimerEvents> pending{};
+        std::vector<detail::DeviceTimerEvents> available{};
+    };
+
+    std::mutex        mutex;
+    std::vector<Node> nodes;
+    NodeId            current{0};
+
+    // Construct with a root node
+    ThreadTree() { nodes.push_back({"", 0, {}, 0, 0}); }
+};
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// Unique identifier of a registry instance
+std::atomic<size_type> g_next_registry_id{0};
+
+//---------------------------------------------------------------------------//
+// Thread-local trees for each registry used by this thread, with the most
+// recently used registry at the back
+struct ThreadTreeCache
+{
+    size_type                  registry_id;
+    TimerRegistry::ThreadTree* tree;
+};
+
+thread_local std::vector<ThreadTreeCache> t_tree_cache;
+
+//---------------------------------------------------------------------------//
+// Add the elapsed time of completed device events to a node for reuse
+void resolve_events(TimerRegistry::ThreadTree::Node* node, bool wait)
+{
+    auto& pending = node->pending;
+    auto  iter    = pending.begin();
+    for (; iter != pending.end() && (wait || iter->ready()); ++iter)
+    {
+        node->time += iter->elapsed();
+        node->available.push_back(std::move(*iter));
+    }
+    pending.erase(pending.begin(), iter);
+}
+
+//---------------------------------------------------------------------------//
+// Add one thread's nodes into a merged tree
+void merge_node(const TimerRegistry::ThreadTree& src,
+                TimerRegistry::NodeId            src_id,
+                TimerTree*                       dst)
+{
+    const auto& node = src.nodes[src_id];
+    if (node.count > 0)
+    {
+        dst->count += node.count;
+        dst->time += node.time;
+        dst->max_time = std::max(dst->max_time, node.time);
+        ++dst->num_threads;
+    }
+
+    for (TimerRegistry::NodeId child_id : node.children)
+    {
+        const char* name = src.nodes[child_id].name;
+        auto        iter = std::find_if(
+            dst->children.begin(),
+            dst->children.end(),
+            [name](const TimerTree& t) { return t.name == name; });
+        if (iter == dst->children.end())
+        {
+            dst->children.push_back({});
+            dst->children.back().name = name;
+            iter                      = dst->children.end() - 1;
+        }
+        merge_node(src, child_id, &*iter);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Write a JSON string, escaping special and control characters
+void write_json_string(std::ostream& os, const std::string& s)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+    os << '"';
+    for (char c : s)
+    {
+        auto uc = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\')
+        {
+            os << '\\' << c;
+        }
+        else if (uc < 0x20)
+        {
+            os << "\\u00" << hex_digits[uc >> 4] << hex_digits[uc & 0xf];
+        }
+        else
+        {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+//---------------------------------------------------------------------------//
+// Write the global registry to the file named by the environment
+void write_global_timers()
+{
+    const char* filename = std::getenv("CELER_TIMER_OUTPUT");
+    CELER_ASSERT(filename);
+    std::ofstream out(filename);
+    TimerRegistry::global().write_json(out);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with timing enabled.
+ */
+TimerRegistry::TimerRegistry() : id_(g_next_registry_id++) {}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+TimerRegistry::~TimerRegistry() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Global registry used by ScopedTimer.
+ */
+TimerRegistry& TimerRegistry::global()
+{
+    static TimerRegistry                 registry;
+    CELER_MAYBE_UNUSED static const bool write_at_exit = [] {
+        if (std::getenv("CELER_TIMER_OUTPUT"))
+        {
+            std::atexit(&write_global_timers);
+            return true;
+        }
+        return false;
+    }();
+    return registry;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the call tree for the current thread.
+ *
+ * The first call on each thread allocates and registers a new tree. Later
+ * calls reuse it, even if the thread used other registries in between.
+ */
+auto TimerRegistry::thread_tree() -> ThreadTree&
+{
+    if (!t_tree_cache.empty() && t_tree_cache.back().registry_id == id_)
+    {
+        return *t_tree_cache.back().tree;
+    }
+
+    auto iter = std::find_if(
+        t_tree_cache.begin(),
+        t_tree_cache.end(),
+        [this](const ThreadTreeCache& c) { return c.registry_id == id_; });
+    if (iter != t_tree_cache.end())
+    {
+        // Move to the back so that repeated calls take the fast path
+        std::swap(*iter, t_tree_cache.back());
+    }
+    else
+    {
+        auto tree = std::make_unique<ThreadTree>();
+        std::lock_guard<std::mutex> scoped_lock(mutex_);
+        threads_.push_back(std::move(tree));
+        t_tree_cache.push_back({id_, threads_.back().get()});
+    }
+    return *t_tree_cache.back().tree;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Enter a named scope on the current thread.
+ */
+auto TimerRegistry::push(ThreadTree& tree, const char* name) -> NodeId
+{
+    CELER_EXPECT(name);
+    std::lock_guard<std::mutex> scoped_lock(tree.mutex);
+    auto& children = tree.nodes[tree.current].children;
+
+    // Look up by address first, then by value (identical string literals in
+    // different translation units may have different addresses)
+    auto iter = std::find_if(children.begin(), children.end(), [&](NodeId n) {
+        return tree.nodes[n].name == name;
+    });
+    if (iter == children.end())
+    {
+        iter = std::find_if(children.begin(), children.end(), [&](NodeId n) {
+            return std::strcmp(tree.nodes[n].name, name) == 0;
+        });
+    }
+
+    NodeId result;
+    if (iter != children.end())
+    {
+        result = *iter;
+    }
+    else
+    {
+        result = tree.nodes.size();
+        tree.nodes[tree.current].children.push_back(result);
+        tree.nodes.push_back({name, tree.current, {}, 0, 0});
+    }
+    tree.current = result;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Leave the current scope, adding elapsed time.
+ */
+void TimerRegistry::pop(ThreadTree& tree, NodeId node, real_type elapsed)
+{
+    CELER_EXPECT(node == tree.current && node != 0);
+    std::lock_guard<std::mutex> scoped_lock(tree.mutex);
+    auto& n = tree.nodes[node];
+    ++n.count;
+    n.time += elapsed;
+    tree.current = n.parent;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a reusable pair of device events for the current scope.
+ *
+ * Events whose elapsed time has been read are reused; otherwise the returned
+ * events are created when they're first started.
+ */
+auto TimerRegistry::acquire_events(ThreadTree& tree, NodeId node)
+    -> detail::DeviceTimerEvents
+{
+    CELER_EXPECT(node == tree.current && node != 0);
+    std::lock_guard<std::mutex> scoped_lock(tree.mutex);
+    auto& available = tree.nodes[node].available;
+    if (available.empty())
+    {
+        return {};
+    }
+    detail::DeviceTimerEvents result = std::move(available.back());
+    available.pop_back();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Leave the current scope, adding the time between device events.
+ *
+ * The elapsed time is added once the device work completes. Events that have
+ * already completed are read here to keep the pending list short; the rest
+ * are read by \c merged.
+ */
+void TimerRegistry::pop_device(ThreadTree&                 tree,
+                               NodeId                      node,
+                               detail::DeviceTimerEvents&& events)
+{
+    CELER_EXPECT(node == tree.current && node != 0);
+    CELER_EXPECT(events);
+    std::lock_guard<std::mutex> scoped_lock(tree.mutex);
+    auto& n = tree.nodes[node];
+    ++n.count;
+    resolve_events(&n, false);
+    n.pending.push_back(std::move(events));
+    tree.current = n.parent;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the results of all threads.
+ *
+ * The root node has no name; its time is the sum of its children's times.
+ * Pending device events are read first, which waits for outstanding device
+ * work to complete. Each thread's tree is locked while it is read.
+ */
+TimerTree TimerRegistry::merged() const
+{
+    TimerTree result;
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    for (const auto& tree : threads_)
+    {
+        std::lock_guard<std::mutex> tree_lock(tree->mutex);
+        for (auto& node : tree->nodes)
+        {
+            resolve_events(&node, true);
+        }
+        merge_node(*tree, 0, &result);
+    }
+    for (const TimerTree& child : result.children)
+    {
+        result.time += child.time;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Clear accumulated times and counts.
+ *
+ * The call trees themselves are kept so that threads inside timed scopes can
+ * still exit them safely.
+ */
+void TimerRegistry::reset()
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    for (auto& tree : threads_)
+    {
+        std::lock_guard<std::mutex> tree_lock(tree->mutex);
+        for (auto& node : tree->nodes)
+        {
+            node.count = 0;
+            node.time  = 0;
+            node.pending.clear();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the merged timing tree as JSON.
+ */
+void TimerRegistry::write_json(std::ostream& os) const
+{
+    celeritas::write_json(os, this->merged());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a timing tree as JSON.
+ */
+void write_json(std::ostream& os, const TimerTree& tree)
+{
+    auto orig_precision
+        = os.precision(std::numeric_limits<real_type>::digits10);
+
+    os << "{\"name\":";
+    write_json_string(os, tree.name);
+    os << ",\"count\":" << tree.count << ",\"time\":" << tree.time
+       << ",\"max_time\":" << tree.max_time
+       << ",\"num_threads\":" << tree.num_threads << ",\"children\":[";
+    for (auto i : range(tree.children.size()))
+    {
+        if (i > 0)
+        {
+            os << ',';
+        }
+        write_json(os, tree.children[i]);
+    }
+    os << "]}";
+
+    os.precision(orig_precision);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
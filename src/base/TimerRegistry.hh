@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TimerRegistry.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+class DeviceTimerEvents;
+} // namespace detail
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulated timing results for a named scope and its nested scopes.
+ */
+struct TimerTree
+{
+    std::string            name;            //!< Scope name
+    size_type              count{0};        //!< Total number of calls
+    real_type              time{0};         //!< Total time over threads [s]
+    real_type              max_time{0};     //!< Maximum time on a thread [s]
+    size_type              num_threads{0};  //!< Threads that entered scope
+    std::vector<TimerTree> children;        //!< Nested scopes
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Registry of hierarchical, per-thread scoped timers.
+ *
+ * Each thread that enters a \c ScopedTimer lazily registers its own call tree,
+ * so timing a scope only touches that thread's data: finding the child node
+ * by name, reading the clock twice, and updating a count and a sum. Nodes are
+ * keyed by the address of the name, which must therefore be a string literal
+ * or otherwise have static storage duration.
+ *
+ * Scopes timed by \c ScopedDeviceTimer store the device events bracketing
+ * their kernel launches instead of a host time. The events are read when the
+ * results are merged, so timing asynchronous launches never synchronizes the
+ * host with the device. Each node keeps the event pairs it has read for reuse
+ * by later scopes.
+ *
+ * The trees of all threads are combined by \c merged (or written as JSON by
+ * \c write_json). Each tree is guarded by its own mutex, which is uncontended
+ * except while merging or resetting, so results can be read while other
+ * threads are timing; scopes that are still open are not counted. If the
+ * \c CELER_TIMER_OUTPUT environment variable is set to a file name, the
+ * global registry writes its JSON timing tree to that file at program exit.
+ */
+class TimerRegistry
+{
+  public:
+    //!@{
+    //! Type aliases
+    using NodeId = size_type;
+    //!@}
+
+    //! Call tree of a single thread
+    struct ThreadTree;
+
+  public:
+    // Construct with timing enabled
+    TimerRegistry();
+
+    // Default destructor
+    ~TimerRegistry();
+
+    // Global registry used by ScopedTimer
+    static TimerRegistry& global();
+
+    //// TIMING ////
+
+    //! Whether timers record data
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    //! Enable or disable timing
+    void enabled(bool value) { enabled_.store(value); }
+
+    // Get the call tree for the current thread
+    ThreadTree& thread_tree();
+
+    // Enter a named scope on the current thread
+    static NodeId push(ThreadTree& tree, const char* name);
+
+    // Leave the current scope, adding elapsed time
+    static void pop(ThreadTree& tree, NodeId node, real_type elapsed);
+
+    // Get a reusable pair of device events for the current scope
+    static detail::DeviceTimerEvents
+    acquire_events(ThreadTree& tree, NodeId node);
+
+    // Leave the current scope, adding the time between device events
+    static void pop_device(ThreadTree&                 tree,
+                           NodeId                      node,
+                           detail::DeviceTimerEvents&& events);
+
+    //// RESULTS ////
+
+    // Combine the results of all threads
+    TimerTree merged() const;
+
+    // Clear accumulated times and counts
+    void reset();
+
+    // Write the merged timing tree as JSON
+    void write_json(std::ostream& os) const;
+
+  private:
+    size_type                                id_;
+    std::atomic<bool>                        enabled_{true};
+    mutable std::mutex                       mutex_;
+    std::vector<std::unique_ptr<ThreadTree>> threads_;
+};
+
+//---------------------------------------------------------------------------//
+// Write a timing tree as JSON
+void write_json(std::ostream& os, const TimerTree& tree);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
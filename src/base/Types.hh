@@ -40,6 +40,13 @@ enum class Interp
     log
 };
 
+//! Memory location of data
+enum class MemSpace
+{
+    host,
+    device
+};
+
 //! Non-convertible type for raw data modeled after std::byte (C++17)
 enum class Byte : unsigned char
 {
@@ -0,0 +1,155 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AtomicsImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <type_traits>
+#include "base/Macros.hh"
+#include "base/Types.hh"
+
+#if !defined(__CUDA_ARCH__) && (defined(__GNUC__) || defined(__clang__))
+#    define CELER_HOST_ATOMICS_ 1
+#else
+#    define CELER_HOST_ATOMICS_ 0
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Memory ordering constraint for an atomic operation.
+ *
+ * Relaxed operations only guarantee atomicity of the modified value, which
+ * matches the semantics of the CUDA \c atomicAdd family. Acquire-release
+ * operations additionally order surrounding reads and writes, as is needed
+ * when the atomic publishes data written by the calling thread.
+ */
+enum class MemOrder
+{
+    relaxed,
+    acq_rel
+};
+
+namespace detail
+{
+#ifdef __CUDA_ARCH__
+//---------------------------------------------------------------------------//
+//! Native device atomic addition
+template<class T>
+inline __device__ T device_atomic_add(T* address, T value)
+{
+    return atomicAdd(address, value);
+}
+
+#    if __CUDA_ARCH__ < 600
+//---------------------------------------------------------------------------//
+/*!
+ * Atomic addition specialization for double-precision on older platforms.
+ *
+ * From CUDA C Programming guide v10.1 p127
+ */
+inline __device__ double device_atomic_add(double* address, double val)
+{
+    ull_int* address_as_ull = reinterpret_cast<ull_int*>(address);
+    ull_int  old            = *address_as_ull;
+    ull_int  assumed;
+    do
+    {
+        assumed = old;
+        old     = atomicCAS(
+            address_as_ull,
+            assumed,
+            __double_as_longlong(val + __longlong_as_double(assumed)));
+        // Note: uses integer comparison to avoid hang in case of NaN (since
+        // NaN != NaN)
+    } while (assumed != old);
+    return __longlong_as_double(old);
+}
+#    endif
+#endif
+
+#if CELER_HOST_ATOMICS_
+//---------------------------------------------------------------------------//
+//! Convert to a GCC/Clang builtin memory order
+constexpr int to_builtin_order(MemOrder order)
+{
+    return order == MemOrder::relaxed ? __ATOMIC_RELAXED : __ATOMIC_ACQ_REL;
+}
+
+//! Memory order for the initial load of a compare-and-swap loop
+constexpr int to_builtin_load_order(MemOrder order)
+{
+    return order == MemOrder::relaxed ? __ATOMIC_RELAXED : __ATOMIC_ACQUIRE;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply an update function atomically using a compare-and-swap loop.
+ *
+ * The comparison is bitwise, so the loop terminates even for NaN values.
+ */
+template<class T, class F>
+inline T host_atomic_update(T* address, F update, MemOrder order)
+{
+    T expected;
+    __atomic_load(address, &expected, to_builtin_load_order(order));
+    T desired = update(expected);
+    while (!__atomic_compare_exchange(address,
+                                      &expected,
+                                      &desired,
+                                      /* weak = */ true,
+                                      to_builtin_order(order),
+                                      __ATOMIC_RELAXED))
+    {
+        desired = update(expected);
+    }
+    return expected;
+}
+
+//---------------------------------------------------------------------------//
+//! Integer add uses a native fetch-add instruction
+template<class T>
+inline T host_atomic_add(T* address, T value, MemOrder order, std::true_type)
+{
+    return __atomic_fetch_add(address, value, to_builtin_order(order));
+}
+
+//! Floating point add requires a compare-and-swap loop
+template<class T>
+inline T host_atomic_add(T* address, T value, MemOrder order, std::false_type)
+{
+    return host_atomic_update(
+        address, [value](T current) { return current + value; }, order);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the stored value if the comparator prefers the new value.
+ *
+ * No store is performed if the stored value is already preferred.
+ */
+template<class T, class Compare>
+inline T host_atomic_replace_if(T* address, T value, Compare cmp, MemOrder order)
+{
+    T expected;
+    __atomic_load(address, &expected, to_builtin_load_order(order));
+    while (cmp(value, expected)
+           && !__atomic_compare_exchange(address,
+                                         &expected,
+                                         &value,
+                                         /* weak = */ true,
+                                         to_builtin_order(order),
+                                         __ATOMIC_RELAXED))
+    {
+    }
+    return expected;
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
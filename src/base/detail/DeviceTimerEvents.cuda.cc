@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DeviceTimerEvents.cuda.cc
+//---------------------------------------------------------------------------//
+#include "DeviceTimerEvents.hh"
+
+#include <cuda_runtime_api.h>
+#include "../Assert.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+struct DeviceTimerEvents::Impl
+{
+    cudaEvent_t start{nullptr};
+    cudaEvent_t stop{nullptr};
+
+    ~Impl()
+    {
+        // Errors are ignored: the CUDA runtime may already be shut down when
+        // the global timer registry is destroyed
+        cudaEventDestroy(start);
+        cudaEventDestroy(stop);
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Construct without recording
+DeviceTimerEvents::DeviceTimerEvents() = default;
+
+//! Destroy events
+DeviceTimerEvents::~DeviceTimerEvents() = default;
+
+//! Move construct
+DeviceTimerEvents::DeviceTimerEvents(DeviceTimerEvents&&) noexcept = default;
+
+//! Move assign
+DeviceTimerEvents&
+DeviceTimerEvents::operator=(DeviceTimerEvents&&) noexcept = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the start event, creating the events if needed.
+ */
+void DeviceTimerEvents::start()
+{
+    if (!impl_)
+    {
+        impl_ = std::make_unique<Impl>();
+        CELER_CUDA_CALL(cudaEventCreate(&impl_->start));
+        CELER_CUDA_CALL(cudaEventCreate(&impl_->stop));
+    }
+    CELER_CUDA_CALL(cudaEventRecord(impl_->start));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the stop event.
+ */
+void DeviceTimerEvents::stop()
+{
+    CELER_EXPECT(impl_);
+    CELER_CUDA_CALL(cudaEventRecord(impl_->stop));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the work between the events has completed.
+ */
+bool DeviceTimerEvents::ready() const
+{
+    CELER_EXPECT(impl_);
+    cudaError_t status = cudaEventQuery(impl_->stop);
+    if (status == cudaErrorNotReady)
+    {
+        return false;
+    }
+    CELER_CUDA_CALL(status);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Elapsed time between the events [s], waiting for completion.
+ */
+real_type DeviceTimerEvents::elapsed() const
+{
+    CELER_EXPECT(impl_);
+    CELER_CUDA_CALL(cudaEventSynchronize(impl_->stop));
+    float milliseconds = 0;
+    CELER_CUDA_CALL(
+        cudaEventElapsedTime(&milliseconds, impl_->start, impl_->stop));
+    return real_type(milliseconds) * real_type(1e-3);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
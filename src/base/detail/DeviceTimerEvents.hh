@@ -0,0 +1,65 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DeviceTimerEvents.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include "../Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Pair of events bracketing asynchronous device work.
+ *
+ * The start and stop events are recorded on the default stream, so recording
+ * them never blocks the host. The elapsed time is only read by \c elapsed,
+ * which waits for the stop event if the work has not completed. The events
+ * are created by the first \c start and can be restarted once their elapsed
+ * time has been read, so that a pool of event pairs avoids creating events on
+ * every launch. Without CUDA, the events are host clock readings.
+ */
+class DeviceTimerEvents
+{
+  public:
+    // Construct without recording
+    DeviceTimerEvents();
+
+    // Destroy events
+    ~DeviceTimerEvents();
+
+    //!@{
+    //! Move but do not copy
+    DeviceTimerEvents(DeviceTimerEvents&&) noexcept;
+    DeviceTimerEvents& operator=(DeviceTimerEvents&&) noexcept;
+    //!@}
+
+    // Record the start event, creating the events if needed
+    void start();
+
+    // Record the stop event
+    void stop();
+
+    // Whether the work between the events has completed
+    bool ready() const;
+
+    // Elapsed time between the events [s], waiting for completion
+    real_type elapsed() const;
+
+    //! Whether events have been created
+    explicit operator bool() const { return static_cast<bool>(impl_); }
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
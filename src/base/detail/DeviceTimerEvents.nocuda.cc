@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DeviceTimerEvents.nocuda.cc
+//---------------------------------------------------------------------------//
+#include "DeviceTimerEvents.hh"
+
+#include "../Assert.hh"
+#include "../Stopwatch.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+struct DeviceTimerEvents::Impl
+{
+    Stopwatch get_elapsed_time;
+    real_type elapsed{0};
+};
+
+//---------------------------------------------------------------------------//
+//! Construct without recording
+DeviceTimerEvents::DeviceTimerEvents() = default;
+
+//! Destroy events
+DeviceTimerEvents::~DeviceTimerEvents() = default;
+
+//! Move construct
+DeviceTimerEvents::DeviceTimerEvents(DeviceTimerEvents&&) noexcept = default;
+
+//! Move assign
+DeviceTimerEvents&
+DeviceTimerEvents::operator=(DeviceTimerEvents&&) noexcept = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start the host clock, since all work is synchronous without CUDA.
+ */
+void DeviceTimerEvents::start()
+{
+    if (!impl_)
+    {
+        impl_ = std::make_unique<Impl>();
+    }
+    impl_->get_elapsed_time = {};
+    impl_->elapsed          = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop the host clock.
+ */
+void DeviceTimerEvents::stop()
+{
+    CELER_EXPECT(impl_);
+    impl_->elapsed = impl_->get_elapsed_time();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Host work is always complete.
+ */
+bool DeviceTimerEvents::ready() const
+{
+    CELER_EXPECT(impl_);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Elapsed host time [s].
+ */
+real_type DeviceTimerEvents::elapsed() const
+{
+    CELER_EXPECT(impl_);
+    return impl_->elapsed;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostAllocation.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include "../Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Alignment of host allocations: one cache line
+constexpr size_type host_alignment = 64;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate uninitialized host memory aligned to a cache line.
+ *
+ * The original \c malloc address is stashed immediately before the aligned
+ * address so that it can be recovered by \c free_aligned_host.
+ */
+inline Byte* allocate_aligned_host(size_type num_bytes)
+{
+    constexpr size_type offset = host_alignment + sizeof(void*);
+    void*               raw    = std::malloc(num_bytes + offset);
+    if (!raw)
+    {
+        throw std::bad_alloc();
+    }
+
+    auto aligned = (reinterpret_cast<std::uintptr_t>(raw) + offset)
+                   & ~static_cast<std::uintptr_t>(host_alignment - 1);
+    void** result = reinterpret_cast<void**>(aligned);
+    result[-1]    = raw;
+    return reinterpret_cast<Byte*>(result);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free memory allocated with \c allocate_aligned_host.
+ */
+inline void free_aligned_host(Byte* ptr) noexcept
+{
+    if (ptr)
+    {
+        std::free(reinterpret_cast<void**>(ptr)[-1]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
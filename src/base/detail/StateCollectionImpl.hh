@@ -0,0 +1,232 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StateCollectionImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "../Array.hh"
+#include "../Macros.hh"
+#include "../Types.hh"
+
+namespace celeritas
+{
+namespace layout
+{
+struct AoS;
+struct SoA;
+template<size_type W>
+struct AoSoA;
+} // namespace layout
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Alignment of each field array in structure-of-arrays storage
+constexpr size_type soa_field_alignment = 64;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Aggregate with one data member per type.
+ *
+ * This is a minimal device-compatible replacement for \c std::tuple. The last
+ * field is terminal (rather than followed by an empty record) so that the
+ * record has no padding beyond what its members require.
+ */
+template<class... Ts>
+struct FieldRecord;
+
+template<class T>
+struct FieldRecord<T>
+{
+    T first;
+};
+
+template<class T, class... Ts>
+struct FieldRecord<T, Ts...>
+{
+    T                  first;
+    FieldRecord<Ts...> rest;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access the I'th member of a field record.
+ */
+template<size_type I, class... Ts>
+struct FieldGetter;
+
+template<class T, class... Ts>
+struct FieldGetter<0, T, Ts...>
+{
+    using type = T;
+
+    static CELER_FORCEINLINE_FUNCTION type& get(FieldRecord<T, Ts...>& r)
+    {
+        return r.first;
+    }
+    static CELER_FORCEINLINE_FUNCTION const type&
+    get(const FieldRecord<T, Ts...>& r)
+    {
+        return r.first;
+    }
+};
+
+template<size_type I, class T, class... Ts>
+struct FieldGetter<I, T, Ts...>
+{
+    using Rest = FieldGetter<I - 1, Ts...>;
+    using type = typename Rest::type;
+
+    static CELER_FORCEINLINE_FUNCTION type& get(FieldRecord<T, Ts...>& r)
+    {
+        return Rest::get(r.rest);
+    }
+    static CELER_FORCEINLINE_FUNCTION const type&
+    get(const FieldRecord<T, Ts...>& r)
+    {
+        return Rest::get(r.rest);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the per-field pointers of structure-of-arrays storage.
+ *
+ * Each field array starts on an aligned boundary so that consecutive threads
+ * access consecutive, aligned addresses.
+ */
+template<class... Ts>
+struct SoaBuilder;
+
+template<class T>
+struct SoaBuilder<T>
+{
+    static_assert(alignof(T) <= soa_field_alignment,
+                  "Field is overaligned for SoA storage");
+
+    static size_type num_bytes(size_type size)
+    {
+        size_type bytes = size * sizeof(T);
+        return (bytes + soa_field_alignment - 1) / soa_field_alignment
+               * soa_field_alignment;
+    }
+
+    static void build(FieldRecord<T*>* ptrs, Byte* data, size_type)
+    {
+        ptrs->first = reinterpret_cast<T*>(data);
+    }
+};
+
+template<class T, class... Ts>
+struct SoaBuilder<T, Ts...>
+{
+    using First = SoaBuilder<T>;
+    using Rest  = SoaBuilder<Ts...>;
+
+    static size_type num_bytes(size_type size)
+    {
+        return First::num_bytes(size) + Rest::num_bytes(size);
+    }
+
+    static void build(FieldRecord<T*, Ts*...>* ptrs, Byte* data, size_type size)
+    {
+        ptrs->first = reinterpret_cast<T*>(data);
+        Rest::build(&ptrs->rest, data + First::num_bytes(size), size);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Storage and element access for a state collection layout.
+ *
+ * Each specialization defines the device-compatible \c storage_type, the
+ * element accessor \c get, and host-side functions for the number of bytes
+ * needed and for building the storage from a raw allocation.
+ */
+template<class L, class... Ts>
+struct StateLayoutTraits;
+
+//! Array of structures: one record per track
+template<class... Ts>
+struct StateLayoutTraits<layout::AoS, Ts...>
+{
+    using record_type  = FieldRecord<Ts...>;
+    using storage_type = record_type*;
+
+    template<size_type I>
+    static CELER_FORCEINLINE_FUNCTION typename FieldGetter<I, Ts...>::type&
+    get(const storage_type& storage, size_type i)
+    {
+        return FieldGetter<I, Ts...>::get(storage[i]);
+    }
+
+    static size_type num_bytes(size_type size)
+    {
+        return size * sizeof(record_type);
+    }
+
+    static storage_type build(Byte* data, size_type)
+    {
+        return reinterpret_cast<storage_type>(data);
+    }
+};
+
+//! Structure of arrays: one contiguous array per field
+template<class... Ts>
+struct StateLayoutTraits<layout::SoA, Ts...>
+{
+    using storage_type = FieldRecord<Ts*...>;
+
+    template<size_type I>
+    static CELER_FORCEINLINE_FUNCTION typename FieldGetter<I, Ts...>::type&
+    get(const storage_type& storage, size_type i)
+    {
+        return FieldGetter<I, Ts*...>::get(storage)[i];
+    }
+
+    static size_type num_bytes(size_type size)
+    {
+        return SoaBuilder<Ts...>::num_bytes(size);
+    }
+
+    static storage_type build(Byte* data, size_type size)
+    {
+        storage_type result;
+        SoaBuilder<Ts...>::build(&result, data, size);
+        return result;
+    }
+};
+
+//! Array of structures of arrays: blocks of W tracks
+template<size_type W, class... Ts>
+struct StateLayoutTraits<layout::AoSoA<W>, Ts...>
+{
+    static_assert(W > 0, "AoSoA block width must be positive");
+
+    using record_type  = FieldRecord<Array<Ts, W>...>;
+    using storage_type = record_type*;
+
+    template<size_type I>
+    static CELER_FORCEINLINE_FUNCTION typename FieldGetter<I, Ts...>::type&
+    get(const storage_type& storage, size_type i)
+    {
+        return FieldGetter<I, Array<Ts, W>...>::get(storage[i / W])[i % W];
+    }
+
+    static size_type num_bytes(size_type size)
+    {
+        return (size + W - 1) / W * sizeof(record_type);
+    }
+
+    static storage_type build(Byte* data, size_type)
+    {
+        return reinterpret_cast<storage_type>(data);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TaskDeque.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include "../Range.hh"
+#include "../Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Contiguous range of indices processed as a single task
+using IndexRange = FiniteRange<size_type>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Split off and return the upper half of a range.
+ */
+inline IndexRange split_upper(IndexRange* r)
+{
+    size_type begin = *r->begin();
+    size_type end   = *r->end();
+    size_type mid   = begin + (end - begin) / 2;
+    *r              = range(begin, mid);
+    return range(mid, end);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Double-ended queue of tasks owned by a single worker thread.
+ *
+ * The owning thread pushes and pops at the back (LIFO, so it works on the
+ * most recently split, cache-warm range). Other threads steal from the front,
+ * which holds the oldest and therefore largest ranges. Access is serialized
+ * with a mutex: contention is limited to steal attempts.
+ */
+class TaskDeque
+{
+  public:
+    //! Add a task to the back (owner only)
+    void push(IndexRange task)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(task);
+    }
+
+    //! Remove a task from the back (owner only)
+    bool pop(IndexRange* task)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty())
+        {
+            return false;
+        }
+        *task = tasks_.back();
+        tasks_.pop_back();
+        return true;
+    }
+
+    //! Remove a task from the front (other threads)
+    bool steal(IndexRange* task)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty())
+        {
+            return false;
+        }
+        *task = tasks_.front();
+        tasks_.pop_front();
+        return true;
+    }
+
+  private:
+    std::mutex             mutex_;
+    std::deque<IndexRange> tasks_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -17,6 +17,7 @@
 #include "ParticleStatePointers.hh"
 #include "Interaction.hh"
 #include "PhysicsInterface.hh"
+#include "RngDrawProfilePointers.hh"
 
 namespace celeritas
 {
@@ -69,6 +70,10 @@ struct ModelInteractState
 //---------------------------------------------------------------------------//
 /*!
  * Input and output device data to a generic Model::interact call.
+ *
+ * The random draw profile is only filled when Celeritas is built with
+ * \c CELERITAS_PROFILE_RNG. If it is not set by the caller, models record into
+ * the global \c RngDrawProfileStore.
  */
 struct ModelInteractPointers
 {
@@ -76,6 +81,7 @@ struct ModelInteractPointers
     ModelInteractState         states;
     SecondaryAllocatorPointers secondaries;
     Span<Interaction>          result;
+    RngDrawProfilePointers     rng_profile;
 
     //! True if valid
     CELER_FUNCTION operator bool() const
@@ -8,7 +8,6 @@
 #include "ParticleParams.hh"
 
 #include "base/Macros.hh"
-#include "comm/Device.hh"
 #include "celeritas_config.h"
 
 namespace celeritas
@@ -49,12 +48,9 @@ ParticleParams::ParticleParams(const Input& defs)
         host_defs_.push_back(std::move(host_def));
     }
 
-    if (celeritas::is_device_enabled())
-    {
-        device_defs_ = DeviceVector<ParticleDef>{host_defs_.size()};
-        device_defs_.copy_to_device(make_span(host_defs_));
-        CELER_ENSURE(device_defs_.size() == defs.size());
-    }
+    device_defs_ = DeviceVector<ParticleDef>{host_defs_.size()};
+    device_defs_.copy_to_device(make_span(host_defs_));
+    CELER_ENSURE(device_defs_.size() == defs.size());
 
     CELER_ENSURE(md_.size() == defs.size());
     CELER_ENSURE(name_to_id_.size() == defs.size());
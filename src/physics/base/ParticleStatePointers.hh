@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "base/Span.hh"
+#include "base/StateCollection.hh"
 #include "base/Types.hh"
 #include "ParticleDef.hh"
 #include "Units.hh"
@@ -33,19 +33,37 @@ struct ParticleTrackState
     units::MevEnergy energy; //!< Kinetic energy [MeV]
 };
 
+//---------------------------------------------------------------------------//
+//! Memory layout of particle track states (change to benchmark alternatives)
+using ParticleStateLayout = layout::SoA;
+
 //---------------------------------------------------------------------------//
 /*!
  * View to the dynamic states of multiple physical particles.
  *
  * The size of the view will be the size of the vector of tracks. Each particle
- * track state corresponds to the thread ID (\c ThreadId).
+ * track state corresponds to the thread ID (\c ThreadId). The fields of \c
+ * ParticleTrackState are stored according to \c ParticleStateLayout.
  *
  * \sa ParticleStateStore (owns the pointed-to data)
  * \sa ParticleTrackView (uses the pointed-to data in a kernel)
  */
 struct ParticleStatePointers
 {
-    Span<ParticleTrackState> vars;
+    //! Field indices in the state collection
+    struct Fields
+    {
+        enum : size_type
+        {
+            def_id,
+            energy
+        };
+    };
+
+    using Collection
+        = StateCollection<ParticleStateLayout, ParticleDefId, units::MevEnergy>;
+
+    Collection vars;
 
     //! Check whether the interface is initialized
     explicit CELER_FUNCTION operator bool() const { return !vars.empty(); }
@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "ParticleStateStore.hh"
 
-#include "base/Array.hh"
+#include "base/StateCollectionStore.t.hh"
 #include "ParticleStatePointers.hh"
 
 namespace celeritas
@@ -19,7 +19,18 @@ namespace celeritas
 ParticleStateStore::ParticleStateStore(size_type size) : vars_(size)
 {
     CELER_EXPECT(size > 0);
-    CELER_ENSURE(!vars_.empty());
+    CELER_ENSURE(vars_.size() == size);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with number of parallel tracks in a given memory space.
+ */
+ParticleStateStore::ParticleStateStore(size_type size, MemSpace space)
+    : vars_(size, space)
+{
+    CELER_EXPECT(size > 0);
+    CELER_ENSURE(vars_.size() == size);
 }
 
 //---------------------------------------------------------------------------//
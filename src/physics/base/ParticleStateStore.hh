@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "base/DeviceVector.hh"
+#include "base/StateCollectionStore.hh"
 #include "base/Types.hh"
 #include "ParticleStatePointers.hh"
 
@@ -23,6 +23,9 @@ class ParticleStateStore
     // Construct from number of track states
     explicit ParticleStateStore(size_type size);
 
+    // Construct from number of track states in a given memory space
+    ParticleStateStore(size_type size, MemSpace space);
+
     //// ACCESSORS ////
 
     // Number of states
@@ -32,7 +35,7 @@ class ParticleStateStore
     ParticleStatePointers device_pointers();
 
   private:
-    DeviceVector<ParticleTrackState> vars_;
+    StateCollectionStore<ParticleStatePointers::Collection> vars_;
 };
 
 //---------------------------------------------------------------------------//
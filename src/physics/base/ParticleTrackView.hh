@@ -85,8 +85,11 @@ class ParticleTrackView
     inline CELER_FUNCTION units::MevMomentumSq momentum_sq() const;
 
   private:
-    const ParticleParamsPointers& params_;
-    ParticleTrackState&           state_;
+    using Fields = ParticleStatePointers::Fields;
+
+    const ParticleParamsPointers&     params_;
+    ParticleStatePointers::Collection states_;
+    ThreadId                          thread_;
 
     inline CELER_FUNCTION const ParticleDef& particle_def() const;
 };
@@ -21,7 +21,7 @@ CELER_FUNCTION
 ParticleTrackView::ParticleTrackView(const ParticleParamsPointers& params,
                                      const ParticleStatePointers&  states,
                                      ThreadId                      id)
-    : params_(params), state_(states.vars[id.get()])
+    : params_(params), states_(states.vars), thread_(id)
 {
     CELER_EXPECT(id < states.vars.size());
 }
@@ -35,7 +35,8 @@ ParticleTrackView::operator=(const Initializer_t& other)
 {
     CELER_EXPECT(other.def_id < params_.defs.size());
     CELER_EXPECT(other.energy >= zero_quantity());
-    state_ = other;
+    states_.get<Fields::def_id>(thread_) = other.def_id;
+    states_.get<Fields::energy>(thread_) = other.energy;
     return *this;
 }
 
@@ -51,7 +52,7 @@ void ParticleTrackView::energy(units::MevEnergy quantity)
 {
     CELER_EXPECT(this->def_id());
     CELER_EXPECT(quantity >= zero_quantity());
-    state_.energy = quantity;
+    states_.get<Fields::energy>(thread_) = quantity;
 }
 
 //---------------------------------------------------------------------------//
@@ -62,7 +63,7 @@ void ParticleTrackView::energy(units::MevEnergy quantity)
  */
 CELER_FUNCTION ParticleDefId ParticleTrackView::def_id() const
 {
-    return state_.def_id;
+    return states_.get<Fields::def_id>(thread_);
 }
 
 //---------------------------------------------------------------------------//
@@ -71,7 +72,7 @@ CELER_FUNCTION ParticleDefId ParticleTrackView::def_id() const
  */
 CELER_FUNCTION units::MevEnergy ParticleTrackView::energy() const
 {
-    return state_.energy;
+    return states_.get<Fields::energy>(thread_);
 }
 
 //---------------------------------------------------------------------------//
@@ -80,7 +81,7 @@ CELER_FUNCTION units::MevEnergy ParticleTrackView::energy() const
  */
 CELER_FUNCTION bool ParticleTrackView::is_stopped() const
 {
-    return state_.energy == zero_quantity();
+    return this->energy() == zero_quantity();
 }
 
 //---------------------------------------------------------------------------//
@@ -224,8 +225,9 @@ CELER_FUNCTION units::MevMomentum ParticleTrackView::momentum() const
  */
 CELER_FUNCTION const ParticleDef& ParticleTrackView::particle_def() const
 {
-    CELER_EXPECT(state_.def_id < params_.defs.size());
-    return params_.defs[state_.def_id.get()];
+    ParticleDefId id = this->def_id();
+    CELER_EXPECT(id < params_.defs.size());
+    return params_.defs[id.get()];
 }
 
 //---------------------------------------------------------------------------//
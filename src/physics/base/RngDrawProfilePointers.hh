@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngDrawProfilePointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Device data for histograms of random draws per call, one per model.
+ *
+ * The histogram of model \em m is stored in \c counts[m * num_bins, (m + 1) *
+ * num_bins): bin \em i is the number of calls that consumed \em i draws, and
+ * the last bin also counts all calls with more draws. The exact total number
+ * of draws of each model is accumulated separately.
+ */
+struct RngDrawProfilePointers
+{
+    Span<ull_int> counts;
+    Span<ull_int> total_draws;
+    size_type     num_bins = 0;
+
+    //! Whether the interface is initialized
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_bins > 0 && counts.size() == total_draws.size() * num_bins;
+    }
+
+    //! Number of models
+    CELER_FUNCTION size_type num_models() const { return total_draws.size(); }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
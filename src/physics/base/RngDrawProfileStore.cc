@@ -0,0 +1,252 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngDrawProfileStore.cc
+//---------------------------------------------------------------------------//
+#include "RngDrawProfileStore.hh"
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <thread>
+#include "celeritas_config.h"
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+#include "ModelInterface.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Write the global profile to the file named by the environment
+void write_global_profile()
+{
+    const char* filename = std::getenv("CELER_RNG_PROFILE_OUTPUT");
+    CELER_ASSERT(filename);
+    std::ofstream out(filename);
+    write_json(out, RngDrawProfileStore::global());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of recorded calls.
+ */
+ull_int RngDrawHistogram::num_calls() const
+{
+    return std::accumulate(counts.begin(), counts.end(), ull_int(0));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Average number of draws per call (zero if no calls were recorded).
+ */
+real_type RngDrawHistogram::mean() const
+{
+    ull_int calls = this->num_calls();
+    return calls > 0 ? real_type(total_draws) / real_type(calls) : 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of models and histogram bins.
+ */
+RngDrawProfileStore::RngDrawProfileStore(size_type num_models,
+                                         size_type num_bins,
+                                         MemSpace  space)
+    : num_bins_(num_bins)
+    , counts_(num_models * num_bins, space)
+    , total_draws_(num_models, space)
+{
+    CELER_EXPECT(space == MemSpace::host || celeritas::is_device_enabled());
+    CELER_EXPECT(num_models > 0);
+    CELER_EXPECT(num_bins > 1);
+
+    this->clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access pointers to the histogram data.
+ */
+RngDrawProfilePointers RngDrawProfileStore::device_pointers()
+{
+    CELER_EXPECT(num_bins_ > 0);
+
+    RngDrawProfilePointers result;
+    result.counts      = counts_.device_pointers();
+    result.total_draws = total_draws_.device_pointers();
+    result.num_bins    = num_bins_;
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Zero all histograms.
+ */
+void RngDrawProfileStore::clear()
+{
+    CELER_EXPECT(num_bins_ > 0);
+
+    std::vector<ull_int> zeros(counts_.size(), 0);
+    counts_.copy_to_device(make_span(zeros));
+    zeros.resize(total_draws_.size());
+    total_draws_.copy_to_device(make_span(zeros));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the histogram of a single model to host.
+ */
+RngDrawHistogram RngDrawProfileStore::histogram(ModelId model) const
+{
+    CELER_EXPECT(model < this->num_models());
+
+    // Copy all data: the histograms are small
+    std::vector<ull_int> counts(counts_.size());
+    counts_.copy_to_host(make_span(counts));
+    std::vector<ull_int> totals(total_draws_.size());
+    total_draws_.copy_to_host(make_span(totals));
+
+    RngDrawHistogram result;
+    auto             start = counts.begin() + model.get() * num_bins_;
+    result.counts.assign(start, start + num_bins_);
+    result.total_draws = totals[model.get()];
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Increase the number of models, keeping existing histograms.
+ *
+ * Copying the existing data back to the host waits for any kernels still
+ * recording into it, so the old storage can be safely released.
+ */
+void RngDrawProfileStore::resize(size_type num_models)
+{
+    CELER_EXPECT(num_bins_ > 0);
+    if (num_models <= this->num_models())
+    {
+        return;
+    }
+
+    std::vector<ull_int> counts(num_models * num_bins_, 0);
+    counts_.copy_to_host({counts.data(), counts_.size()});
+    std::vector<ull_int> totals(num_models, 0);
+    total_draws_.copy_to_host({totals.data(), total_draws_.size()});
+
+    const MemSpace space = total_draws_.memspace();
+    counts_              = DeviceVector<ull_int>(counts.size(), space);
+    counts_.copy_to_device(make_span(counts));
+    total_draws_ = DeviceVector<ull_int>(totals.size(), space);
+    total_draws_.copy_to_device(make_span(totals));
+    CELER_ENSURE(this->num_models() == num_models);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Global store filled by model interactions.
+ *
+ * The store starts with a single model and grows as models record into it.
+ * It uses device memory if a device is available. Like the memory pools, it
+ * is never destroyed so that it can be written at exit.
+ */
+RngDrawProfileStore& RngDrawProfileStore::global()
+{
+    static RngDrawProfileStore* profile = new RngDrawProfileStore(
+        1,
+        64,
+        celeritas::is_device_enabled() ? MemSpace::device : MemSpace::host);
+    CELER_MAYBE_UNUSED static const bool write_at_exit = [] {
+        if (std::getenv("CELER_RNG_PROFILE_OUTPUT"))
+        {
+            std::atexit(&write_global_profile);
+            return true;
+        }
+        return false;
+    }();
+    return *profile;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the model's random draws in the global store if profiling is enabled.
+ *
+ * Profile pointers already provided by the caller are kept. Without
+ * \c CELERITAS_PROFILE_RNG the pointers are returned unchanged.
+ *
+ * The global store is not thread-safe: growing it for a new model releases
+ * the storage that an earlier launch may still be recording into. Kernels
+ * that use it must therefore be launched from a single host thread, which is
+ * checked in debug builds.
+ */
+ModelInteractPointers
+add_rng_profile(ModelId model, const ModelInteractPointers& pointers)
+{
+    CELER_EXPECT(model);
+    ModelInteractPointers result = pointers;
+#if CELERITAS_PROFILE_RNG
+    if (!result.rng_profile)
+    {
+        static const std::thread::id owner = std::this_thread::get_id();
+        CELER_ASSERT(std::this_thread::get_id() == owner);
+
+        RngDrawProfileStore& profile = RngDrawProfileStore::global();
+        profile.resize(model.get() + 1);
+        result.rng_profile = profile.device_pointers();
+    }
+#endif
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the histograms of all models as JSON.
+ *
+ * The output is an array indexed by model ID, each with the number of calls,
+ * the mean draws per call, and the histogram counts.
+ */
+void write_json(std::ostream& os, const RngDrawProfileStore& profile)
+{
+    auto orig_precision
+        = os.precision(std::numeric_limits<real_type>::digits10);
+
+    os << '[';
+    for (auto model : range(profile.num_models()))
+    {
+        if (model > 0)
+        {
+            os << ',';
+        }
+        RngDrawHistogram hist = profile.histogram(ModelId(model));
+        os << "{\"model\":" << model
+           << ",\"num_calls\":" << hist.num_calls()
+           << ",\"total_draws\":" << hist.total_draws
+           << ",\"mean\":" << hist.mean() << ",\"counts\":[";
+        for (auto i : range(hist.counts.size()))
+        {
+            if (i > 0)
+            {
+                os << ',';
+            }
+            os << hist.counts[i];
+        }
+        os << "]}";
+    }
+    os << ']';
+
+    os.precision(orig_precision);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
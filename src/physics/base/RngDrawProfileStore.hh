@@ -0,0 +1,100 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngDrawProfileStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "RngDrawProfilePointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+struct ModelInteractPointers;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Histogram of random draws per call for a single model.
+ */
+struct RngDrawHistogram
+{
+    std::vector<ull_int> counts;  //!< Calls per number of draws (last: >=)
+    ull_int              total_draws{0}; //!< Exact number of draws
+
+    // Number of recorded calls
+    ull_int num_calls() const;
+
+    // Average number of draws per call
+    real_type mean() const;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Manage storage for per-model random draw histograms.
+ *
+ * The histograms are filled by \c RngDrawProfiler in interaction kernels and
+ * copied back to the host for reporting. A high mean number of draws per call
+ * indicates an inefficient rejection loop.
+ *
+ * When Celeritas is built with \c CELERITAS_PROFILE_RNG, models record into
+ * the global store unless the caller provides its own profile pointers (see
+ * \c add_rng_profile). If the \c CELER_RNG_PROFILE_OUTPUT environment
+ * variable is set to a file name, the global store writes its JSON histograms
+ * to that file at program exit. The global store may only be used from a
+ * single host thread.
+ */
+class RngDrawProfileStore
+{
+  public:
+    // Construct with no storage (profiling disabled)
+    RngDrawProfileStore() = default;
+
+    // Construct with the number of models and histogram bins
+    RngDrawProfileStore(size_type num_models,
+                        size_type num_bins,
+                        MemSpace  space = MemSpace::device);
+
+    //! Number of models
+    size_type num_models() const { return total_draws_.size(); }
+
+    //! Number of bins per histogram
+    size_type num_bins() const { return num_bins_; }
+
+    // Access pointers to the histogram data
+    RngDrawProfilePointers device_pointers();
+
+    // Zero all histograms
+    void clear();
+
+    // Copy the histogram of a single model to host
+    RngDrawHistogram histogram(ModelId model) const;
+
+    // Increase the number of models, keeping existing histograms
+    void resize(size_type num_models);
+
+    // Global store filled by model interactions
+    static RngDrawProfileStore& global();
+
+  private:
+    size_type             num_bins_{0};
+    DeviceVector<ull_int> counts_;
+    DeviceVector<ull_int> total_draws_;
+};
+
+//---------------------------------------------------------------------------//
+// Write the histograms of all models as JSON
+void write_json(std::ostream& os, const RngDrawProfileStore& profile);
+
+//---------------------------------------------------------------------------//
+// Record the model's random draws in the global store if profiling is enabled
+ModelInteractPointers
+add_rng_profile(ModelId model, const ModelInteractPointers& pointers);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngDrawProfiler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "RngDrawProfilePointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Record the number of random draws consumed by a model interaction.
+ *
+ * This is meant to be used with a \c CountingRngEngine wrapped around the
+ * track's engine. Recording is thread safe and a no-op if the profile
+ * pointers are not set, so interaction kernels can profile unconditionally
+ * when built with \c CELERITAS_PROFILE_RNG.
+ *
+ * \code
+    CountingRngEngine<RngEngine> counted_rng(rng);
+    ptrs.result[tid.get()] = interact(counted_rng);
+    RngDrawProfiler record_draws(ptrs.rng_profile);
+    record_draws(kn.model_id, counted_rng.count());
+   \endcode
+ */
+class RngDrawProfiler
+{
+  public:
+    // Construct from device data
+    explicit inline CELER_FUNCTION
+    RngDrawProfiler(const RngDrawProfilePointers& data);
+
+    // Record the draws of a single call
+    inline CELER_FUNCTION void operator()(ModelId model, size_type num_draws);
+
+  private:
+    const RngDrawProfilePointers& data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "RngDrawProfiler.i.hh"
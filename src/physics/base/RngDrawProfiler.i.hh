@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngDrawProfiler.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "base/Atomics.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from device data.
+ */
+CELER_FUNCTION
+RngDrawProfiler::RngDrawProfiler(const RngDrawProfilePointers& data)
+    : data_(data)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the draws of a single call.
+ */
+CELER_FUNCTION void
+RngDrawProfiler::operator()(ModelId model, size_type num_draws)
+{
+    if (!data_)
+        return;
+
+    CELER_EXPECT(model < data_.num_models());
+    size_type bin = num_draws < data_.num_bins ? num_draws
+                                               : data_.num_bins - 1;
+    atomic_add(&data_.counts[model.get() * data_.num_bins + bin], ull_int(1));
+    atomic_add(&data_.total_draws[model.get()], ull_int(num_draws));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -8,6 +8,8 @@
 #include "BetheHeitlerModel.hh"
 
 #include "base/Assert.hh"
+#include "base/ScopedDeviceTimer.hh"
+#include "physics/base/RngDrawProfileStore.hh"
 #include "physics/base/PDGNumber.hh"
 
 namespace celeritas
@@ -56,7 +58,9 @@ void BetheHeitlerModel::interact(
     CELER_MAYBE_UNUSED const ModelInteractPointers& pointers) const
 {
 #if CELERITAS_USE_CUDA
-    detail::bethe_heitler_interact(interface_, pointers);
+    ScopedDeviceTimer time_interact("BetheHeitlerModel::interact");
+    detail::bethe_heitler_interact(
+        interface_, add_rng_profile(this->model_id(), pointers));
 #else
     CELER_ASSERT_UNREACHABLE();
 #endif
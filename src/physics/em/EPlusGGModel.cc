@@ -8,6 +8,8 @@
 #include "EPlusGGModel.hh"
 
 #include "base/Assert.hh"
+#include "base/ScopedDeviceTimer.hh"
+#include "physics/base/RngDrawProfileStore.hh"
 #include "physics/base/PDGNumber.hh"
 
 namespace celeritas
@@ -58,7 +60,9 @@ void EPlusGGModel::interact(
     CELER_MAYBE_UNUSED const ModelInteractPointers& pointers) const
 {
 #if CELERITAS_USE_CUDA
-    detail::eplusgg_interact(interface_, pointers);
+    ScopedDeviceTimer time_interact("EPlusGGModel::interact");
+    detail::eplusgg_interact(
+        interface_, add_rng_profile(this->model_id(), pointers));
 #else
     CELER_ASSERT_UNREACHABLE();
 #endif
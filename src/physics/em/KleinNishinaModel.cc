@@ -8,6 +8,8 @@
 #include "KleinNishinaModel.hh"
 
 #include "base/Assert.hh"
+#include "base/ScopedDeviceTimer.hh"
+#include "physics/base/RngDrawProfileStore.hh"
 #include "physics/base/PDGNumber.hh"
 
 namespace celeritas
@@ -54,7 +56,9 @@ void KleinNishinaModel::interact(
     CELER_MAYBE_UNUSED const ModelInteractPointers& pointers) const
 {
 #if CELERITAS_USE_CUDA
-    detail::klein_nishina_interact(interface_, pointers);
+    ScopedDeviceTimer time_interact("KleinNishinaModel::interact");
+    detail::klein_nishina_interact(
+        interface_, add_rng_profile(this->model_id(), pointers));
 #else
     CELER_ASSERT_UNREACHABLE();
 #endif
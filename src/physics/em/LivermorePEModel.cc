@@ -8,6 +8,8 @@
 #include "LivermorePEModel.hh"
 
 #include "base/Assert.hh"
+#include "base/ScopedDeviceTimer.hh"
+#include "physics/base/RngDrawProfileStore.hh"
 #include "comm/Device.hh"
 #include "physics/base/PDGNumber.hh"
 
@@ -58,7 +60,9 @@ void LivermorePEModel::interact(
     CELER_MAYBE_UNUSED const ModelInteractPointers& pointers) const
 {
 #if CELERITAS_USE_CUDA
-    detail::livermore_pe_interact(interface_, pointers);
+    ScopedDeviceTimer time_interact("LivermorePEModel::interact");
+    detail::livermore_pe_interact(
+        interface_, add_rng_profile(this->model_id(), pointers));
 #else
     CELER_ASSERT_UNREACHABLE();
 #endif
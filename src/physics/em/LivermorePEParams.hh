@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "base/DeviceVector.hh"
+#include "base/CollectionArena.hh"
 #include "io/ImportPhysicsVector.hh"
 #include "physics/material/Types.hh"
 #include "LivermorePEParamsPointers.hh"
@@ -63,19 +63,27 @@ class LivermorePEParams
     // Access Livermore data on the device
     LivermorePEParamsPointers device_pointers() const;
 
+    //! Packed host/device data
+    const CollectionArena& arena() const { return arena_; }
+
   private:
-    std::vector<LivermoreElement>  host_elements_;
-    std::vector<LivermoreSubshell> host_shells_;
-    std::vector<real_type>         host_data_;
+    // Host data used during construction
+    struct HostData
+    {
+        std::vector<LivermoreElement>  elements;
+        std::vector<LivermoreSubshell> shells;
+        std::vector<real_type>         reals;
+    };
 
-    DeviceVector<LivermoreElement>  device_elements_;
-    DeviceVector<LivermoreSubshell> device_shells_;
-    DeviceVector<real_type>         device_data_;
+    CollectionArena              arena_;
+    ArenaSlot<LivermoreElement>  elements_;
+    ArenaSlot<LivermoreSubshell> shells_;
+    ArenaSlot<real_type>         reals_;
 
     // HELPER FUNCTIONS
-    void                    append_livermore_element(const ElementInput& inp);
-    Span<LivermoreSubshell> extend_shells(const ElementInput& inp);
-    Span<real_type>         extend_data(const std::vector<real_type>& data);
+    void append_livermore_element(const ElementInput& inp, HostData* data);
+    ItemRange<LivermoreSubshell>
+    extend_shells(const ElementInput& inp, HostData* data);
 };
 
 //---------------------------------------------------------------------------//
@@ -8,9 +8,10 @@
 #pragma once
 
 #include "base/Macros.hh"
-#include "base/Span.hh"
+#include "base/Collection.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
+#include "physics/material/Types.hh"
 #include "MockXsCalculator.hh"
 
 namespace celeritas
@@ -30,8 +31,8 @@ struct LivermoreSubshell
 
     // Fit parameters for the integrated subshell photoionization cross
     // sections in the two different energy ranges (used above 5 keV)
-    Span<const real_type> param_low;
-    Span<const real_type> param_high;
+    ItemRange<real_type> param_low;
+    ItemRange<real_type> param_high;
 };
 
 //---------------------------------------------------------------------------//
@@ -49,12 +50,11 @@ struct LivermoreElement
     // Total cross section above the K-shell energy but below the energy
     // threshold for the parameterized cross sections. Uses spline
     // interpolation.
-    // TODO: value grid
     ValueGrid xs_high;
 
     // SUBSHELL CROSS SECTIONS
 
-    Span<const LivermoreSubshell> shells;
+    ItemRange<LivermoreSubshell> shells;
 
     // Energy threshold for using the parameterized subshell cross sections in
     // the lower and upper energy range
@@ -65,10 +65,16 @@ struct LivermoreElement
 //---------------------------------------------------------------------------//
 /*!
  * Access Livermore data on device.
+ *
+ * Elements are indexed by element ID and refer to their subshells, and both
+ * refer to their tabulated data and fit parameters, by ranges of items in the
+ * \c shells and \c reals collections.
  */
 struct LivermorePEParamsPointers
 {
-    Span<const LivermoreElement> elements;
+    Collection<const LivermoreElement, ElementDefId> elements;
+    Collection<const LivermoreSubshell>              shells;
+    Collection<const real_type>                      reals;
 
     //! Check whether the interface is assigned
     explicit inline CELER_FUNCTION operator bool() const
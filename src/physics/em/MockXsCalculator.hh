@@ -8,6 +8,7 @@
 #pragma once
 
 #include "base/Macros.hh"
+#include "base/Collection.hh"
 #include "base/Span.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
@@ -17,13 +18,16 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Storage for energy and cross sections.
+ *
+ * Cross sections are interpolated linearly in energy, or with a cubic spline
+ * if second derivatives are present.
  * TODO: temporary
  */
 struct ValueGrid
 {
-    Span<const real_type> energy;
-    Span<const real_type> xs;
-    Interp                interp;
+    ItemRange<real_type> energy;
+    ItemRange<real_type> xs;
+    ItemRange<real_type> deriv2; //!< Spline second derivatives (optional)
 };
 
 //---------------------------------------------------------------------------//
@@ -37,17 +41,21 @@ class XsCalculator
     //@{
     //! Type aliases
     using MevEnergy = units::MevEnergy;
+    using Values    = Collection<const real_type>;
     //@}
 
   public:
     // Construct from state-independent data
-    explicit inline CELER_FUNCTION XsCalculator(const ValueGrid& data);
+    inline CELER_FUNCTION
+    XsCalculator(const ValueGrid& grid, const Values& values);
 
     // Find and interpolate basesd on the particle track's current energy
     inline CELER_FUNCTION real_type operator()(const real_type energy) const;
 
   private:
-    const ValueGrid& data_;
+    Span<const real_type> energy_;
+    Span<const real_type> xs_;
+    Span<const real_type> deriv2_;
 };
 
 //---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 #include <cmath>
 #include "base/Interpolator.hh"
 #include "base/Macros.hh"
+#include "physics/grid/NonuniformGrid.hh"
 
 namespace celeritas
 {
@@ -15,10 +16,15 @@ namespace celeritas
 /*!
  * Construct from state-independent data.
  */
-CELER_FUNCTION XsCalculator::XsCalculator(const ValueGrid& data) : data_(data)
+CELER_FUNCTION
+XsCalculator::XsCalculator(const ValueGrid& grid, const Values& values)
+    : energy_(values[grid.energy])
+    , xs_(values[grid.xs])
+    , deriv2_(values[grid.deriv2])
 {
-    CELER_EXPECT(data_.energy.size() > 0);
-    CELER_EXPECT(data_.xs.size() > 0);
+    CELER_EXPECT(energy_.size() > 0);
+    CELER_EXPECT(xs_.size() == energy_.size());
+    CELER_EXPECT(deriv2_.empty() || deriv2_.size() == energy_.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -29,28 +35,36 @@ CELER_FUNCTION real_type XsCalculator::operator()(const real_type energy) const
 {
     // Snap out-of-bounds values to closest grid points
     real_type result;
-    if (energy <= data_.energy.front())
+    if (energy <= energy_.front())
     {
-        result = data_.xs.front();
+        result = xs_.front();
     }
-    else if (energy >= data_.energy.back())
+    else if (energy >= energy_.back())
     {
-        result = data_.xs.back();
+        result = xs_.back();
     }
     else
     {
-        // Get the energy bin.
-        // TODO: Should do a binary search, but this class is just a
-        // placeholder anyway.
-        auto bin = data_.energy.size();
-        while (data_.energy[--bin] >= energy) {}
-        CELER_ASSERT(bin + 1 < data_.xs.size());
+        // Get the energy bin
+        auto bin = NonuniformGrid<real_type>(energy_).find(energy);
+        CELER_ASSERT(bin + 1 < xs_.size());
 
         // Interpolate *linearly* on energy using the bin data.
         LinearInterpolator<real_type> interpolate_xs(
-            {data_.energy[bin], data_.xs[bin]},
-            {data_.energy[bin + 1], data_.xs[bin + 1]});
+            {energy_[bin], xs_[bin]},
+            {energy_[bin + 1], xs_[bin + 1]});
         result = interpolate_xs(energy);
+
+        if (!deriv2_.empty())
+        {
+            // Add cubic spline correction
+            real_type width = energy_[bin + 1] - energy_[bin];
+            real_type b     = (energy - energy_[bin]) / width;
+            real_type a     = 1 - b;
+            result += width * width / 6
+                      * ((a * a - 1) * a * deriv2_[bin]
+                         + (b * b - 1) * b * deriv2_[bin + 1]);
+        }
     }
 
     return result;
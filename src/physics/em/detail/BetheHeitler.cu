@@ -16,6 +16,11 @@
 #include "random/cuda/RngEngine.hh"
 #include "BetheHeitlerInteractor.hh"
 
+#if CELERITAS_PROFILE_RNG
+#    include "physics/base/RngDrawProfiler.hh"
+#    include "random/CountingRngEngine.hh"
+#endif
+
 namespace celeritas
 {
 namespace detail
@@ -64,7 +69,14 @@ __global__ void bethe_heitler_interact_kernel(const BetheHeitlerPointers  bh,
         material_view.element_view(celeritas::ElementComponentId{0}));
 
     RngEngine rng(ptrs.states.rng, tid);
+#if CELERITAS_PROFILE_RNG
+    CountingRngEngine<RngEngine> counted_rng(rng);
+    ptrs.result[tid.get()] = interact(counted_rng);
+    RngDrawProfiler record_draws(ptrs.rng_profile);
+    record_draws(bh.model_id, counted_rng.count());
+#else
     ptrs.result[tid.get()] = interact(rng);
+#endif
     CELER_ENSURE(ptrs.result[tid.get()]);
 }
 
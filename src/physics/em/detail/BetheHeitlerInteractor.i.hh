@@ -10,6 +10,7 @@
 #include "base/Constants.hh"
 #include "random/distributions/BernoulliDistribution.hh"
 #include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformAzimuthDistribution.hh"
 #include "random/distributions/UniformRealDistribution.hh"
 
 namespace celeritas
@@ -147,19 +148,15 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
 
     // Sample secondary directions.
     // Note that momentum is not exactly conserved.
-    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
-    real_type                          phi  = sample_phi(rng);
-    real_type                          sinp = std::sin(phi);
-    real_type                          cosp = std::cos(phi);
+    UniformAzimuthDistribution<real_type, SamplingMethod::rejection> sample_phi;
+    const Array<real_type, 2> azimuth = sample_phi(rng);
     // Electron
     real_type cost = this->sample_cos_theta(secondaries[0].energy.value(), rng);
-    secondaries[0].direction
-        = rotate(from_spherical(cost, phi), inc_direction_);
-    // Positron
-    cost           = sample_cos_theta(secondaries[1].energy.value(), rng);
-    real_type sint = std::sqrt(1 - ipow<2>(cost));
+    secondaries[0].direction = rotate(cost, azimuth, inc_direction_);
+    // Positron is emitted in the opposite azimuthal direction
+    cost = sample_cos_theta(secondaries[1].energy.value(), rng);
     secondaries[1].direction
-        = rotate({-sint * cosp, -sint * sinp, cost}, inc_direction_);
+        = rotate(cost, {-azimuth[0], -azimuth[1]}, inc_direction_);
 
     return result;
 }
@@ -16,6 +16,11 @@
 #include "physics/base/SecondaryAllocatorView.hh"
 #include "EPlusGGInteractor.hh"
 
+#if CELERITAS_PROFILE_RNG
+#    include "physics/base/RngDrawProfiler.hh"
+#    include "random/CountingRngEngine.hh"
+#endif
+
 namespace celeritas
 {
 namespace detail
@@ -54,7 +59,14 @@ __global__ void eplusgg_interact_kernel(const EPlusGGPointers       epgg,
     EPlusGGInteractor interact(
         epgg, particle, model.states.direction[tid.get()], allocate_secondaries);
     RngEngine rng(model.states.rng, tid);
+#if CELERITAS_PROFILE_RNG
+    CountingRngEngine<RngEngine> counted_rng(rng);
+    model.result[tid.get()] = interact(counted_rng);
+    RngDrawProfiler record_draws(model.rng_profile);
+    record_draws(epgg.model_id, counted_rng.count());
+#else
     model.result[tid.get()] = interact(rng);
+#endif
 
     CELER_ENSURE(model.result[tid.get()]);
 }
@@ -10,6 +10,7 @@
 #include "random/distributions/BernoulliDistribution.hh"
 #include "random/distributions/GenerateCanonical.hh"
 #include "random/distributions/IsotropicDistribution.hh"
+#include "random/distributions/UniformAzimuthDistribution.hh"
 
 #include <iostream>
 
@@ -64,7 +65,7 @@ CELER_FUNCTION Interaction EPlusGGInteractor::operator()(Engine& rng)
         secondaries[0].energy = secondaries[1].energy
             = units::MevEnergy{shared_.electron_mass};
 
-        IsotropicDistribution<real_type> gamma_dir;
+        IsotropicDistribution<real_type, SamplingMethod::rejection> gamma_dir;
         secondaries[0].direction = gamma_dir(rng);
         for (int i = 0; i < 3; ++i)
         {
@@ -103,11 +104,12 @@ CELER_FUNCTION Interaction EPlusGGInteractor::operator()(Engine& rng)
         const real_type eplus_moment = std::sqrt(inc_energy_ * total_energy);
 
         // Sample and save outgoing secondary data
-        UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+        UniformAzimuthDistribution<real_type, SamplingMethod::rejection>
+            sample_phi;
 
         secondaries[0].energy = units::MevEnergy{gamma_energy};
         secondaries[0].direction
-            = rotate(from_spherical(cost, sample_phi(rng)), inc_direction_);
+            = rotate(cost, sample_phi(rng), inc_direction_);
 
         secondaries[1].energy = units::MevEnergy{total_energy - gamma_energy};
         for (int i = 0; i < 3; ++i)
@@ -15,6 +15,11 @@
 #include "random/cuda/RngEngine.hh"
 #include "KleinNishinaInteractor.hh"
 
+#if CELERITAS_PROFILE_RNG
+#    include "physics/base/RngDrawProfiler.hh"
+#    include "random/CountingRngEngine.hh"
+#endif
+
 namespace celeritas
 {
 namespace detail
@@ -51,7 +56,14 @@ __global__ void klein_nishina_interact_kernel(const KleinNishinaPointers  kn,
         kn, particle, ptrs.states.direction[tid.get()], allocate_secondaries);
 
     RngEngine rng(ptrs.states.rng, tid);
+#if CELERITAS_PROFILE_RNG
+    CountingRngEngine<RngEngine> counted_rng(rng);
+    ptrs.result[tid.get()] = interact(counted_rng);
+    RngDrawProfiler record_draws(ptrs.rng_profile);
+    record_draws(kn.model_id, counted_rng.count());
+#else
     ptrs.result[tid.get()] = interact(rng);
+#endif
     CELER_ENSURE(ptrs.result[tid.get()]);
 }
 
@@ -9,6 +9,7 @@
 #include "base/Constants.hh"
 #include "random/distributions/BernoulliDistribution.hh"
 #include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformAzimuthDistribution.hh"
 #include "random/distributions/UniformRealDistribution.hh"
 
 namespace celeritas
@@ -104,10 +105,9 @@ CELER_FUNCTION Interaction KleinNishinaInteractor::operator()(Engine& rng)
     result.secondaries = {electron_secondary, 1};
 
     // Sample azimuthal direction and rotate the outgoing direction
-    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+    UniformAzimuthDistribution<real_type, SamplingMethod::rejection> sample_phi;
     result.direction
-        = rotate(from_spherical(1 - one_minus_costheta, sample_phi(rng)),
-                 result.direction);
+        = rotate(1 - one_minus_costheta, sample_phi(rng), result.direction);
 
     // Outgoing secondary is an electron
     electron_secondary->def_id = shared_.electron_id;
@@ -18,6 +18,11 @@
 #include "LivermorePEInteractor.hh"
 #include "LivermorePEMicroXsCalculator.hh"
 
+#if CELERITAS_PROFILE_RNG
+#    include "physics/base/RngDrawProfiler.hh"
+#    include "random/CountingRngEngine.hh"
+#endif
+
 namespace celeritas
 {
 namespace detail
@@ -65,7 +70,14 @@ __global__ void livermore_pe_interact_kernel(const LivermorePEPointers   pe,
                                    ptrs.states.direction[tid.get()],
                                    allocate_secondaries);
 
+#if CELERITAS_PROFILE_RNG
+    CountingRngEngine<RngEngine> counted_rng(rng);
+    ptrs.result[tid.get()] = interact(counted_rng);
+    RngDrawProfiler record_draws(ptrs.rng_profile);
+    record_draws(pe.model_id, counted_rng.count());
+#else
     ptrs.result[tid.get()] = interact(rng);
+#endif
     CELER_ENSURE(ptrs.result[tid.get()]);
 }
 
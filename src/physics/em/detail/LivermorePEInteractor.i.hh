@@ -8,7 +8,7 @@
 
 #include "base/ArrayUtils.hh"
 #include "physics/em/MockXsCalculator.hh"
-#include "random/distributions/UniformRealDistribution.hh"
+#include "random/distributions/UniformAzimuthDistribution.hh"
 
 namespace celeritas
 {
@@ -58,25 +58,26 @@ CELER_FUNCTION Interaction LivermorePEInteractor::operator()(Engine& rng)
     // Sample the shell from which the photoelectron is emitted
     real_type cutoff = generate_canonical(rng) * calc_micro_xs_(el_id_);
     real_type xs     = 0.;
-    const LivermoreElement& el = shared_.data.elements[el_id_.get()];
-    unsigned int            shell_id;
-    for (shell_id = 0; shell_id < el.shells.size() - 1; ++shell_id)
+    const LivermoreElement&       el = shared_.data.elements[el_id_];
+    Span<const LivermoreSubshell> shells = shared_.data.shells[el.shells];
+    unsigned int                  shell_id;
+    for (shell_id = 0; shell_id < shells.size() - 1; ++shell_id)
     {
-        const auto& shell = el.shells[shell_id];
+        const auto& shell = shells[shell_id];
         if (inc_energy_ > shell.binding_energy)
         {
             if (inc_energy_ < el.thresh_low)
             {
                 // Use the tabulated subshell cross sections
-                XsCalculator calc_xs(shell.xs);
+                XsCalculator calc_xs(shell.xs, shared_.data.reals);
                 xs += ipow<3>(inv_energy_) * calc_xs(inc_energy_.value());
             }
             else
             {
                 // Use parameterized integrated subshell cross sections
-                const auto& param = inc_energy_ >= el.thresh_high
-                                        ? shell.param_high
-                                        : shell.param_low;
+                Span<const real_type> param = shared_.data.reals[
+                    inc_energy_ >= el.thresh_high ? shell.param_high
+                                                  : shell.param_low];
 
                 // Calculate the subshell cross section from the fit parameters
                 // and energy as \sigma(E) = a_1 / E + a_2 / E^2 + a_3 / E^3 +
@@ -101,7 +102,7 @@ CELER_FUNCTION Interaction LivermorePEInteractor::operator()(Engine& rng)
     // If the binding energy of the sampled shell is greater than the incident
     // photon energy, no secondaries are produced and the energy is deposited
     // locally.
-    MevEnergy binding_energy = el.shells[shell_id].binding_energy;
+    MevEnergy binding_energy = shells[shell_id].binding_energy;
     if (binding_energy > inc_energy_)
     {
         result.energy_deposition = inc_energy_;
@@ -189,8 +190,8 @@ CELER_FUNCTION Real3 LivermorePEInteractor::sample_direction(Engine& rng) const
 
     // Sample the azimuthal angle and calculate the direction of the
     // photoelectron
-    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
-    return rotate(from_spherical(1. - nu, sample_phi(rng)), inc_direction_);
+    UniformAzimuthDistribution<real_type, SamplingMethod::rejection> sample_phi;
+    return rotate(1. - nu, sample_phi(rng), inc_direction_);
 }
 
 //---------------------------------------------------------------------------//
@@ -32,12 +32,13 @@ CELER_FUNCTION
 real_type LivermorePEMicroXsCalculator::operator()(ElementDefId el_id) const
 {
     CELER_EXPECT(el_id);
-    const LivermoreElement& el = shared_.data.elements[el_id.get()];
+    const LivermoreElement&       el = shared_.data.elements[el_id];
+    Span<const LivermoreSubshell> shells = shared_.data.shells[el.shells];
 
     // In Geant4, if the incident gamma energy is below the lowest binding
     // energy, it is set to the binding energy so that the photoelectric cross
     // section is constant rather than zero for low energy gammas.
-    MevEnergy energy     = max(inc_energy_, el.shells.back().binding_energy);
+    MevEnergy energy     = max(inc_energy_, shells.back().binding_energy);
     real_type inv_energy = 1. / energy.value();
 
     real_type result = 0.;
@@ -45,9 +46,9 @@ real_type LivermorePEMicroXsCalculator::operator()(ElementDefId el_id) const
     {
         // Fit parameters from the final shell are used to calculate the cross
         // section integrated over all subshells
-        const auto& shell = el.shells.back();
-        const auto& param = energy >= el.thresh_high ? shell.param_high
-                                                     : shell.param_low;
+        const auto& shell = shells.back();
+        Span<const real_type> param = shared_.data.reals[
+            energy >= el.thresh_high ? shell.param_high : shell.param_low];
 
         // Use the parameterization of the integrated subshell cross sections
         // clang-format off
@@ -57,17 +58,17 @@ real_type LivermorePEMicroXsCalculator::operator()(ElementDefId el_id) const
             + inv_energy * (param[4] + inv_energy * param[5])))));
         // clang-format on
     }
-    else if (energy >= el.shells.front().binding_energy)
+    else if (energy >= shells.front().binding_energy)
     {
         // Use tabulated cross sections above K-shell energy but below energy
         // limit for parameterization
-        XsCalculator calc_xs(el.xs_high);
+        XsCalculator calc_xs(el.xs_high, shared_.data.reals);
         result = ipow<3>(inv_energy) * calc_xs(energy.value());
     }
     else
     {
         // Use tabulated cross sections below K-shell energy
-        XsCalculator calc_xs(el.xs_low);
+        XsCalculator calc_xs(el.xs_low, shared_.data.reals);
         result = ipow<3>(inv_energy) * calc_xs(energy.value());
     }
     return result;
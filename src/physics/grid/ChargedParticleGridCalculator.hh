@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ChargedParticleGridCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Quantity.hh"
+#include "XsGridPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find and interpolate the stopping power or range of a charged particle.
+ *
+ * The energy loss and range tables have a uniform grid in log(E) and are
+ * interpolated linearly in energy. Below the lowest tabulated energy, the
+ * value is extrapolated proportionally to sqrt(E) as in Geant4; above the
+ * highest, it is constant. A range table is inverted by
+ * \c InverseRangeCalculator, so unlike the energy loss it is never stored
+ * with spline coefficients.
+ *
+ * \code
+    EnergyLossCalculator calc_dedx(eloss_params);
+    real_type dedx = calc_dedx(particle.energy());
+    RangeCalculator calc_range(range_params);
+    real_type step = calc_range(particle.energy());
+   \endcode
+ */
+class ChargedParticleGridCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = Quantity<XsGridPointers::EnergyUnits>;
+    //!@}
+
+  public:
+    // Construct from state-independent data
+    inline explicit CELER_FUNCTION
+    ChargedParticleGridCalculator(const XsGridPointers& data);
+
+    // Calculate dE/dx [MeV/cm] or range [cm] at the given energy
+    inline CELER_FUNCTION real_type operator()(Energy energy) const;
+
+  private:
+    const XsGridPointers& data_;
+};
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Calculators for the tabulated charged particle quantities
+using EnergyLossCalculator = ChargedParticleGridCalculator;
+using RangeCalculator      = ChargedParticleGridCalculator;
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "ChargedParticleGridCalculator.i.hh"
@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ChargedParticleGridCalculator.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "MultiPhysicsGridCalculator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from state-independent data.
+ */
+CELER_FUNCTION
+ChargedParticleGridCalculator::ChargedParticleGridCalculator(
+    const XsGridPointers& data)
+    : data_(data)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(data.prime_index == size_type(-1));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the tabulated value at the given energy.
+ */
+CELER_FUNCTION real_type
+ChargedParticleGridCalculator::operator()(Energy energy) const
+{
+    const real_type emin = data_.energy.empty()
+                               ? std::exp(data_.log_energy.front)
+                               : real_type(data_.energy.front());
+    if (energy.value() < emin)
+    {
+        return data_.value.front() * std::sqrt(energy.value() / emin);
+    }
+    return MultiPhysicsGridCalculator(data_, energy)(data_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,57 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseRangeCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Quantity.hh"
+#include "XsGridPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the energy that a charged particle would have for a given range.
+ *
+ * This is the exact inverse of \c RangeCalculator on the same range table:
+ * the range values (strictly increasing with energy) are treated as a
+ * nonuniform grid, the bin is found with a branchless binary search, and the
+ * energy is interpolated linearly between the bin's energy edges. No separate
+ * inverse table or iterative solve is needed. Below the lowest tabulated
+ * range, the energy is extrapolated proportionally to the square of the range;
+ * above the highest, it is the maximum tabulated energy.
+ *
+ * \code
+    InverseRangeCalculator calc_energy(range_params);
+    Energy post_step_energy = calc_energy(range - step);
+   \endcode
+ */
+class InverseRangeCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = Quantity<XsGridPointers::EnergyUnits>;
+    //!@}
+
+  public:
+    // Construct from range data
+    inline explicit CELER_FUNCTION
+    InverseRangeCalculator(const XsGridPointers& data);
+
+    // Find the energy corresponding to the given range [cm]
+    inline CELER_FUNCTION Energy operator()(real_type range) const;
+
+  private:
+    const XsGridPointers& data_;
+
+    inline CELER_FUNCTION real_type grid_energy(size_type i) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "InverseRangeCalculator.i.hh"
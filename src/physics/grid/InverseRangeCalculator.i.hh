@@ -0,0 +1,80 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseRangeCalculator.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "NonuniformGrid.hh"
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from range data.
+ *
+ * The range values must be strictly increasing and linearly interpolated;
+ * this is checked when the table is built (see \c ValueGridLogBuilder).
+ */
+CELER_FUNCTION
+InverseRangeCalculator::InverseRangeCalculator(const XsGridPointers& data)
+    : data_(data)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(data.prime_index == size_type(-1));
+    CELER_EXPECT(data.deriv2.empty());
+    CELER_EXPECT(data.value.front() > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the energy corresponding to the given range.
+ */
+CELER_FUNCTION auto InverseRangeCalculator::operator()(real_type range) const
+    -> Energy
+{
+    CELER_EXPECT(range >= 0);
+
+    const auto& range_grid = data_.value;
+    if (range < range_grid.front())
+    {
+        // Inverse of the sqrt(E) extrapolation in the range calculator
+        return Energy{this->grid_energy(0)
+                      * ipow<2>(range / range_grid.front())};
+    }
+
+    // Compare in storage precision for consistency with the grid
+    const grid_real_type grid_range = range;
+    if (grid_range >= range_grid.back())
+    {
+        return Energy{this->grid_energy(range_grid.size() - 1)};
+    }
+
+    size_type i = NonuniformGrid<grid_real_type>(range_grid).find(grid_range);
+    real_type lower_range  = range_grid[i];
+    real_type upper_range  = range_grid[i + 1];
+    real_type lower_energy = this->grid_energy(i);
+    real_type upper_energy = this->grid_energy(i + 1);
+    return Energy{lower_energy
+                  + (range - lower_range) * (upper_energy - lower_energy)
+                        / (upper_range - lower_range)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the energy at a grid point.
+ */
+CELER_FUNCTION real_type InverseRangeCalculator::grid_energy(size_type i) const
+{
+    if (!data_.energy.empty())
+    {
+        return data_.energy[i];
+    }
+    return std::exp(UniformGrid(data_.log_energy)[i]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
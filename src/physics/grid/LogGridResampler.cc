@@ -0,0 +1,180 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LogGridResampler.cc
+//---------------------------------------------------------------------------//
+#include "LogGridResampler.hh"
+
+#include <algorithm>
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "NonuniformGrid.hh"
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Linear interpolation between two points
+real_type interpolate(
+    real_type x, real_type x_lo, real_type x_hi, real_type y_lo, real_type y_hi)
+{
+    return y_lo + (x - x_lo) * (y_hi - y_lo) / (x_hi - x_lo);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate piecewise linear tabulated data.
+ */
+class TableEvaluator
+{
+  public:
+    TableEvaluator(Span<const real_type> x, Span<const real_type> y)
+        : grid_(x), y_(y)
+    {
+    }
+
+    real_type operator()(real_type x) const
+    {
+        if (x <= grid_.front())
+            return y_.front();
+        if (x >= grid_.back())
+            return y_.back();
+
+        size_type i = grid_.find(x);
+        return interpolate(x, grid_[i], grid_[i + 1], y_[i], y_[i + 1]);
+    }
+
+  private:
+    NonuniformGrid<real_type> grid_;
+    Span<const real_type>     y_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with error tolerance.
+ */
+LogGridResampler::LogGridResampler(Options opts) : opts_(opts)
+{
+    CELER_EXPECT(opts_.max_error > 0);
+    CELER_EXPECT(opts_.min_value >= 0);
+    CELER_EXPECT(opts_.max_size >= 2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resample the given table.
+ *
+ * The energy grid must be positive and nondecreasing; repeated energies (e.g.
+ * at an absorption edge) are allowed, but the discontinuity they represent
+ * can't be captured by a uniform grid.
+ */
+ResampledGrid
+LogGridResampler::operator()(SpanConstReal energy, SpanConstReal value) const
+{
+    CELER_EXPECT(energy.size() >= 2);
+    CELER_EXPECT(value.size() == energy.size());
+    CELER_EXPECT(energy.front() > 0 && energy.back() > energy.front());
+    CELER_EXPECT(std::is_sorted(energy.begin(), energy.end()));
+
+    TableEvaluator calc_orig(energy, value);
+    const real_type log_emin = std::log(energy.front());
+    const real_type log_emax = std::log(energy.back());
+
+    // Values below this magnitude are compared absolutely
+    const real_type abs_value = opts_.min_value * [value] {
+        real_type result = 0;
+        for (real_type v : value)
+        {
+            result = std::max(result, std::fabs(v));
+        }
+        return result;
+    }();
+    auto calc_error = [abs_value](real_type actual, real_type expected) {
+        real_type denom = std::max(std::fabs(expected), abs_value);
+        return denom > 0 ? std::fabs(actual - expected) / denom : 0;
+    };
+
+    ResampledGrid result;
+    size_type     size = std::min(energy.size(), opts_.max_size);
+    while (true)
+    {
+        // Sample the input at the grid points
+        result.log_energy = UniformGridPointers::from_bounds(
+            log_emin, log_emax, size);
+        UniformGrid            loge_grid(result.log_energy);
+        std::vector<real_type> grid_energy(size);
+        result.value.resize(size);
+        for (auto i : range(size))
+        {
+            grid_energy[i]  = std::exp(loge_grid[i]);
+            result.value[i] = calc_orig(grid_energy[i]);
+        }
+        grid_energy.front()  = energy.front();
+        grid_energy.back()   = energy.back();
+        result.value.front() = value.front();
+        result.value.back()  = value.back();
+
+        // Compare at the midpoint of each resampled bin and at each input
+        // point inside it
+        result.max_error        = 0;
+        result.max_error_energy = 0;
+        auto check = [&](size_type bin, real_type e) {
+            real_type err = calc_error(interpolate(e,
+                                                   grid_energy[bin],
+                                                   grid_energy[bin + 1],
+                                                   result.value[bin],
+                                                   result.value[bin + 1]),
+                                       calc_orig(e));
+            if (err > result.max_error)
+            {
+                result.max_error        = err;
+                result.max_error_energy = e;
+            }
+        };
+        auto orig_iter = energy.begin();
+        for (auto bin : range(size - 1))
+        {
+            check(bin, std::exp((loge_grid[bin] + loge_grid[bin + 1]) / 2));
+            for (; orig_iter != energy.end()
+                   && *orig_iter < grid_energy[bin + 1];
+                 ++orig_iter)
+            {
+                check(bin, *orig_iter);
+            }
+        }
+
+        if (result.max_error <= opts_.max_error)
+        {
+            break;
+        }
+
+        CELER_VALIDATE(size < opts_.max_size,
+                       "failed to resample table with "
+                           << energy.size() << " points over ["
+                           << energy.front() << ", " << energy.back()
+                           << "] MeV: relative error " << result.max_error
+                           << " at " << result.max_error_energy
+                           << " MeV exceeds " << opts_.max_error << " with "
+                           << opts_.max_size << " points");
+
+        // Linear interpolation error scales as the square of the bin width
+        size_type next_size = static_cast<size_type>(std::ceil(
+            1.1 * size * std::sqrt(result.max_error / opts_.max_error)));
+        size = std::min(std::max(next_size, size + 1), opts_.max_size);
+    }
+
+    CELER_ENSURE(result.value.size() == result.log_energy.size);
+    CELER_ENSURE(result.max_error <= opts_.max_error);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
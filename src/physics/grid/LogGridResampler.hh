@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LogGridResampler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "UniformGridPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated values on a grid uniform in log(E).
+ */
+struct ResampledGrid
+{
+    UniformGridPointers    log_energy;   //!< Resampled grid
+    std::vector<real_type> value;        //!< Values at each grid point
+    real_type              max_error{0}; //!< Max relative error found
+    real_type              max_error_energy{0}; //!< Where it was found [MeV]
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resample a tabulated function onto a uniform grid in log(E).
+ *
+ * Imported physics vectors (e.g. Geant4 "free" vectors and Livermore tables)
+ * can have arbitrary grid spacing, requiring a search on every lookup. This
+ * class interpolates such a vector onto a grid uniform in log(E) so that the
+ * bin is found in constant time with \c UniformGrid::find.
+ *
+ * The input is treated as piecewise linear in energy, as is the resampled
+ * grid (see \c PhysicsGridCalculator). The number of grid points is increased
+ * until the maximum relative difference between the two, checked at every
+ * input grid point and at the midpoint of every resampled bin, is below the
+ * requested tolerance. Values smaller in magnitude than \c min_value (relative
+ * to the largest value in the table) are compared absolutely, so that
+ * thresholds where the function rises from zero don't require unbounded
+ * refinement.
+ *
+ * \code
+    LogGridResampler resample({1e-3});
+    ResampledGrid grid = resample(make_span(vec.x), make_span(vec.y));
+    store.push_back(ValueGridType::macro_xs, grid.log_energy, size_type(-1),
+                    make_span(grid.value));
+   \endcode
+ */
+class LogGridResampler
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SpanConstReal = Span<const real_type>;
+    //!@}
+
+    struct Options
+    {
+        real_type max_error{1e-3};  //!< Relative error tolerance
+        real_type min_value{1e-6};  //!< Relative magnitude for abs comparison
+        size_type max_size{1 << 14}; //!< Maximum number of grid points
+    };
+
+  public:
+    // Construct with error tolerance
+    explicit LogGridResampler(Options opts);
+
+    // Resample the given table
+    ResampledGrid operator()(SpanConstReal energy, SpanConstReal value) const;
+
+  private:
+    Options opts_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
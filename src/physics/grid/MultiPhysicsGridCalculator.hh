@@ -0,0 +1,79 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MultiPhysicsGridCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Quantity.hh"
+#include "base/Span.hh"
+#include "XsGridPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate several tables that share a log-energy grid.
+ *
+ * The logarithm of the energy, the bin search, and the interpolation fraction
+ * are computed once at construction; evaluating each table is then just two
+ * loads and a multiply-add (plus the "prime energy" corrections). The bin-edge
+ * energies are taken from the grid's precomputed \c energy array if present,
+ * avoiding the two exponentials otherwise needed to invert the log grid.
+ * Tables with spline second derivatives add a cubic correction to the linear
+ * interpolation.
+ *
+ * All tables evaluated by an instance *must* have the same log-energy grid as
+ * the one it was constructed with.
+ *
+ * \code
+    MultiPhysicsGridCalculator calc_xs(tables[0], particle.energy());
+    for (auto i : range(tables.size()))
+    {
+        xs[i] = calc_xs(tables[i]);
+    }
+   \endcode
+ */
+class MultiPhysicsGridCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = Quantity<XsGridPointers::EnergyUnits>;
+    //!@}
+
+  public:
+    // Find the energy bin on the grid shared by all tables
+    inline CELER_FUNCTION
+    MultiPhysicsGridCalculator(const XsGridPointers& grid, Energy energy);
+
+    // Interpolate a single table
+    inline CELER_FUNCTION real_type operator()(const XsGridPointers& data) const;
+
+    // Interpolate all tables
+    inline CELER_FUNCTION void operator()(Span<const XsGridPointers> data,
+                                          Span<real_type> result) const;
+
+    //! Index of the lower grid point (clamped to the grid)
+    CELER_FUNCTION size_type lower_index() const { return lower_idx_; }
+
+    //! Fraction of the energy bin, linear in energy (zero off the grid)
+    CELER_FUNCTION real_type fraction() const { return frac_; }
+
+  private:
+    real_type energy_;
+    size_type num_points_;
+    size_type lower_idx_;
+    bool      interior_;
+    real_type upper_energy_;
+    real_type frac_;
+    real_type spline_lower_;
+    real_type spline_upper_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "MultiPhysicsGridCalculator.i.hh"
@@ -0,0 +1,130 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MultiPhysicsGridCalculator.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Assert.hh"
+#include "physics/grid/UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the energy bin on the grid shared by all tables.
+ *
+ * Only the \c log_energy and \c energy members of the grid are used.
+ * Out-of-bounds energies are snapped to the closest grid point.
+ */
+CELER_FUNCTION
+MultiPhysicsGridCalculator::MultiPhysicsGridCalculator(
+    const XsGridPointers& grid, Energy energy)
+    : energy_(energy.value())
+    , num_points_(grid.log_energy.size)
+    , interior_(false)
+    , upper_energy_(0)
+    , frac_(0)
+    , spline_lower_(0)
+    , spline_upper_(0)
+{
+    CELER_EXPECT(grid);
+
+    UniformGrid loge_grid(grid.log_energy);
+    real_type   loge = std::log(energy_);
+
+    if (loge <= loge_grid.front())
+    {
+        lower_idx_ = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        lower_idx_ = num_points_ - 1;
+    }
+    else
+    {
+        // Locate the energy bin
+        lower_idx_ = loge_grid.find(loge);
+        CELER_ASSERT(lower_idx_ + 1 < num_points_);
+        interior_ = true;
+
+        // Get the bin edges in linear energy
+        real_type lower_energy;
+        if (!grid.energy.empty())
+        {
+            lower_energy  = grid.energy[lower_idx_];
+            upper_energy_ = grid.energy[lower_idx_ + 1];
+        }
+        else
+        {
+            lower_energy  = std::exp(loge_grid[lower_idx_]);
+            upper_energy_ = std::exp(loge_grid[lower_idx_ + 1]);
+        }
+
+        // Interpolate *linearly* on energy
+        real_type width = upper_energy_ - lower_energy;
+        frac_           = (energy_ - lower_energy) / width;
+
+        // Weights of the second derivatives for spline interpolation
+        real_type scale = width * width / 6;
+        real_type b     = frac_;
+        real_type a     = 1 - b;
+        spline_lower_   = scale * (a * a - 1) * a;
+        spline_upper_   = scale * (b * b - 1) * b;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate a single table.
+ */
+CELER_FUNCTION real_type
+MultiPhysicsGridCalculator::operator()(const XsGridPointers& data) const
+{
+    CELER_EXPECT(data.log_energy.size == num_points_);
+
+    real_type result = data.value[lower_idx_];
+    if (interior_)
+    {
+        real_type upper_xs = data.value[lower_idx_ + 1];
+        if (lower_idx_ + 1 == data.prime_index)
+        {
+            // Cross section data for the upper point has *already* been scaled
+            // by E -- undo the scaling.
+            upper_xs /= upper_energy_;
+        }
+        result += frac_ * (upper_xs - result);
+
+        if (!data.deriv2.empty())
+        {
+            // Add cubic spline correction
+            result += spline_lower_ * data.deriv2[lower_idx_]
+                      + spline_upper_ * data.deriv2[lower_idx_ + 1];
+        }
+    }
+
+    if (lower_idx_ >= data.prime_index)
+    {
+        result /= energy_;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate all tables.
+ */
+CELER_FUNCTION void
+MultiPhysicsGridCalculator::operator()(Span<const XsGridPointers> data,
+                                       Span<real_type> result) const
+{
+    CELER_EXPECT(data.size() == result.size());
+    for (size_type i = 0; i != data.size(); ++i)
+    {
+        result[i] = (*this)(data[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NonuniformGrid.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interact with a nonuniform grid of increasing values.
+ *
+ * This is the counterpart of \c UniformGrid for "free" physics vectors (e.g.
+ * imported tables with arbitrary energy points). The grid points are stored
+ * externally and referenced by a span.
+ *
+ * Bins are found with a branchless binary search: each halving step is a
+ * single comparison whose result selects the new lower bound without a
+ * branch, so the search takes exactly ceil(log2(size - 1)) steps and threads
+ * in a warp searching for different values stay converged.
+ */
+template<class T>
+class NonuniformGrid
+{
+  public:
+    //!@{
+    //! Type aliases
+    using size_type  = ::celeritas::size_type;
+    using value_type = T;
+    using SpanConstT = Span<const T>;
+    //!@}
+
+  public:
+    // Construct with data
+    explicit inline CELER_FUNCTION NonuniformGrid(SpanConstT values);
+
+    //! Number of grid points
+    CELER_FUNCTION size_type size() const { return data_.size(); }
+
+    //! Minimum/first value
+    CELER_FUNCTION value_type front() const { return data_.front(); }
+
+    //! Maximum/last value
+    CELER_FUNCTION value_type back() const { return data_.back(); }
+
+    // Access the value at the given grid point
+    inline CELER_FUNCTION value_type operator[](size_type i) const;
+
+    // Find the index of the given value (*must* be in bounds)
+    inline CELER_FUNCTION size_type find(value_type value) const;
+
+    //! Get the data used to construct this class
+    CELER_FUNCTION SpanConstT values() const { return data_; }
+
+  private:
+    SpanConstT data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "NonuniformGrid.i.hh"
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NonuniformGrid.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with data.
+ *
+ * The values must be strictly increasing; this is only checked at the
+ * endpoints.
+ */
+template<class T>
+CELER_FUNCTION NonuniformGrid<T>::NonuniformGrid(SpanConstT values)
+    : data_(values)
+{
+    CELER_EXPECT(data_.size() >= 2);
+    CELER_EXPECT(data_.front() < data_.back());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the value at the given grid point.
+ */
+template<class T>
+CELER_FUNCTION auto NonuniformGrid<T>::operator[](size_type i) const
+    -> value_type
+{
+    CELER_EXPECT(i < data_.size());
+    return data_[i];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the value bin such that data[result] <= value < data[result + 1].
+ *
+ * The given value *must* be in range, because out-of-bounds values usually
+ * require different treatment (e.g. clipping to the boundary values rather
+ * than interpolating). It's easier to test the exceptional cases (final grid
+ * point) outside of the grid view.
+ */
+template<class T>
+CELER_FUNCTION size_type NonuniformGrid<T>::find(value_type value) const
+{
+    CELER_EXPECT(value >= this->front() && value < this->back());
+
+    // Invariant: data[first] <= value, and the result is in
+    // [first, first + count)
+    const value_type* first = data_.data();
+    size_type         count = data_.size() - 1;
+    while (count > 1)
+    {
+        const size_type half = count / 2;
+        first                = (first[half] <= value) ? first + half : first;
+        count -= half;
+    }
+
+    size_type bin = first - data_.data();
+    CELER_ENSURE(bin + 1 < this->size());
+    return bin;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
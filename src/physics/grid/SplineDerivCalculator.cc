@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SplineDerivCalculator.cc
+//---------------------------------------------------------------------------//
+#include "SplineDerivCalculator.hh"
+
+#include "base/Assert.hh"
+#include "base/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with boundary condition.
+ */
+SplineDerivCalculator::SplineDerivCalculator(BoundaryCondition bc) : bc_(bc)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the second derivatives at each grid point.
+ *
+ * Continuity of the first derivative at each interior point gives a
+ * tridiagonal system for the second derivatives, which is solved with the
+ * Thomas algorithm. For the not-a-knot condition, the end second derivatives
+ * are eliminated from the first and last equations; with only three points
+ * the result is the parabola through them, and with two it is a line.
+ */
+auto SplineDerivCalculator::operator()(SpanConstReal x, SpanConstReal y) const
+    -> VecReal
+{
+    CELER_EXPECT(x.size() >= 2);
+    CELER_EXPECT(y.size() == x.size());
+
+    const size_type n = x.size();
+    VecReal         result(n, 0);
+    if (n == 2)
+    {
+        return result;
+    }
+
+    // Bin widths and slopes
+    VecReal h(n - 1);
+    VecReal slope(n - 1);
+    for (auto i : range(n - 1))
+    {
+        h[i] = x[i + 1] - x[i];
+        CELER_EXPECT(h[i] > 0);
+        slope[i] = (y[i + 1] - y[i]) / h[i];
+    }
+
+    if (n == 3 && bc_ == BoundaryCondition::not_a_knot)
+    {
+        real_type deriv2 = 2 * (slope[1] - slope[0]) / (h[0] + h[1]);
+        result.assign(n, deriv2);
+        return result;
+    }
+
+    // Set up tridiagonal system for interior points 1..n-2
+    const size_type m = n - 2;
+    VecReal         lower(m), diag(m), upper(m), rhs(m);
+    for (auto j : range(m))
+    {
+        size_type i = j + 1;
+        lower[j]    = h[i - 1];
+        diag[j]     = 2 * (h[i - 1] + h[i]);
+        upper[j]    = h[i];
+        rhs[j]      = 6 * (slope[i] - slope[i - 1]);
+    }
+
+    if (bc_ == BoundaryCondition::not_a_knot)
+    {
+        // Eliminate y''_0 = ((h0 + h1) y''_1 - h0 y''_2) / h1
+        diag[0] += h[0] * (h[0] + h[1]) / h[1];
+        upper[0] -= h[0] * h[0] / h[1];
+
+        // Eliminate y''_{n-1}
+        real_type hl = h[n - 2];
+        real_type hp = h[n - 3];
+        diag[m - 1] += hl * (hl + hp) / hp;
+        lower[m - 1] -= hl * hl / hp;
+    }
+
+    // Forward elimination
+    for (auto j : range<size_type>(1, m))
+    {
+        real_type w = lower[j] / diag[j - 1];
+        diag[j] -= w * upper[j - 1];
+        rhs[j] -= w * rhs[j - 1];
+    }
+
+    // Back substitution
+    result[m] = rhs[m - 1] / diag[m - 1];
+    for (auto k : range<size_type>(1, m))
+    {
+        size_type j   = m - 1 - k;
+        result[j + 1] = (rhs[j] - upper[j] * result[j + 2]) / diag[j];
+    }
+
+    if (bc_ == BoundaryCondition::not_a_knot)
+    {
+        result[0] = ((h[0] + h[1]) * result[1] - h[0] * result[2]) / h[1];
+        result[n - 1] = ((h[n - 2] + h[n - 3]) * result[n - 2]
+                         - h[n - 2] * result[n - 3])
+                        / h[n - 3];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
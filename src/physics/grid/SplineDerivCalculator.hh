@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SplineDerivCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the second derivatives of a cubic spline through tabulated data.
+ *
+ * Given the second derivatives \f$ y''_i \f$ at each grid point, the spline
+ * in bin \f$ [x_i, x_{i+1}] \f$ with width \f$ h \f$ is
+ * \f[
+   y = a y_i + b y_{i+1}
+     + \frac{h^2}{6} \left[(a^3 - a) y''_i + (b^3 - b) y''_{i+1}\right]
+ * \f]
+ * where \f$ b = (x - x_i) / h \f$ is the fraction of the bin and
+ * \f$ a = 1 - b \f$. This is the form used by Geant4's \c G4PhysicsVector,
+ * so interpolation costs one extra multiply-add per point compared to linear
+ * interpolation, plus a load of the two second derivatives.
+ *
+ * The \c not_a_knot boundary condition (continuous third derivative at the
+ * second and second-to-last points) matches Geant4's default "base" spline
+ * and reproduces cubic functions exactly; the \c natural condition sets the
+ * second derivative to zero at both ends.
+ *
+ * \code
+    using BC = SplineDerivCalculator::BoundaryCondition;
+    SplineDerivCalculator  calc_deriv(BC::not_a_knot);
+    std::vector<real_type> deriv2 = calc_deriv(make_span(x), make_span(y));
+   \endcode
+ */
+class SplineDerivCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SpanConstReal = Span<const real_type>;
+    using VecReal       = std::vector<real_type>;
+    //!@}
+
+    enum class BoundaryCondition
+    {
+        natural,    //!< Zero second derivative at the endpoints
+        not_a_knot, //!< Continuous third derivative near the endpoints
+    };
+
+  public:
+    // Construct with boundary condition
+    explicit SplineDerivCalculator(BoundaryCondition bc);
+
+    // Calculate the second derivatives at each grid point
+    VecReal operator()(SpanConstReal x, SpanConstReal y) const;
+
+  private:
+    BoundaryCondition bc_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TotalXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Quantity.hh"
+#include "physics/base/Types.hh"
+#include "MultiPhysicsGridCalculator.hh"
+#include "TotalXsGridPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the total cross section and select the interacting process.
+ *
+ * A single energy lookup on the combined table of a particle in a material
+ * gives the total macroscopic cross section (for sampling the distance to the
+ * next interaction) and the interpolated cumulative process fractions, which
+ * are contiguous in memory. Selecting a process is a linear scan over the
+ * fractions in the energy bin; the number of discrete processes per particle
+ * is small enough that this is faster than a binary search.
+ *
+ * The fractions are interpolated linearly in energy between grid points
+ * rather than computed as ratios of interpolated cross sections, so they can
+ * differ from the exact per-process ratios inside a bin by the interpolation
+ * error of the tables themselves.
+ *
+ * \code
+    TotalXsCalculator calc_xs(total_xs, particle.energy());
+    ExponentialDistribution<> sample_distance(calc_xs.total());
+    real_type step = sample_distance(rng);
+    ...
+    ParticleProcessId pid = calc_xs.select(generate_canonical(rng));
+   \endcode
+ */
+class TotalXsCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = MultiPhysicsGridCalculator::Energy;
+    //!@}
+
+  public:
+    // Find the energy bin and calculate the total cross section
+    inline CELER_FUNCTION
+    TotalXsCalculator(const TotalXsGridPointers& data, Energy energy);
+
+    //! Total macroscopic cross section [1/cm]
+    CELER_FUNCTION real_type total() const { return total_; }
+
+    // Select a process from a uniform sample in [0, 1)
+    inline CELER_FUNCTION ParticleProcessId select(real_type xi) const;
+
+  private:
+    const TotalXsGridPointers& data_;
+    MultiPhysicsGridCalculator calc_;
+    real_type                  total_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "TotalXsCalculator.i.hh"
@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TotalXsCalculator.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the energy bin and calculate the total cross section.
+ */
+CELER_FUNCTION
+TotalXsCalculator::TotalXsCalculator(const TotalXsGridPointers& data,
+                                     Energy                     energy)
+    : data_(data), calc_(data.total, energy)
+{
+    CELER_EXPECT(data);
+    total_ = calc_(data_.total);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Select a process from a uniform sample in [0, 1).
+ *
+ * The result is the index of the process in the list used to build the
+ * table.
+ */
+CELER_FUNCTION ParticleProcessId TotalXsCalculator::select(real_type xi) const
+{
+    CELER_EXPECT(xi >= 0 && xi < 1);
+
+    const size_type num_cdf = data_.num_processes - 1;
+    const size_type lower   = calc_.lower_index();
+    const real_type frac    = calc_.fraction();
+    const grid_real_type* lower_cdf = data_.cdf.data() + lower * num_cdf;
+    const grid_real_type* upper_cdf = lower_cdf + num_cdf;
+
+    for (size_type p = 0; p != num_cdf; ++p)
+    {
+        real_type cdf = lower_cdf[p];
+        if (frac > 0)
+        {
+            cdf += frac * (upper_cdf[p] - cdf);
+        }
+        if (xi < cdf)
+        {
+            return ParticleProcessId(p);
+        }
+    }
+    return ParticleProcessId(num_cdf);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,40 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TotalXsGridPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "XsGridPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Total cross section over several processes, with per-process fractions.
+ *
+ * The \c cdf array stores, at each grid point, the cumulative fraction of the
+ * total cross section due to processes \c 0 through \c p. The last process
+ * (whose cumulative fraction is always unity) is omitted, so there are \code
+ * num_processes - 1 \endcode values per grid point. They are stored point by
+ * point so that all fractions for an energy bin are contiguous:
+ * \code cdf[i * (num_processes - 1) + p] \endcode.
+ */
+struct TotalXsGridPointers
+{
+    XsGridPointers             total;            //!< Total macro xs [1/cm]
+    size_type                  num_processes{0}; //!< Number of processes
+    Span<const grid_real_type> cdf;              //!< Cumulative fractions
+
+    //! Whether the interface is initialized and valid
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return total && num_processes > 0
+               && cdf.size() == total.value.size() * (num_processes - 1);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,9 +7,15 @@
 //---------------------------------------------------------------------------//
 #include "ValueGridBuilder.hh"
 
+#include <algorithm>
 #include <cmath>
+#include "base/Assert.hh"
+#include "base/Range.hh"
 #include "base/SoftEqual.hh"
+#include "io/ImportPhysicsVector.hh"
 #include "physics/grid/UniformGrid.hh"
+#include "SplineDerivCalculator.hh"
+#include "ValueGridStore.hh"
 
 namespace celeritas
 {
@@ -40,6 +46,30 @@ bool is_nonnegative(SpanConstReal vec)
         vec.begin(), vec.end(), [](real_type v) { return v >= 0; });
 }
 
+bool is_log_spaced(SpanConstReal vec)
+{
+    if (vec.size() < 2 || vec.front() <= 0)
+        return false;
+
+    real_type log_delta = std::log(vec.back() / vec.front()) / (vec.size() - 1);
+    for (auto i : range(vec.size() - 1))
+    {
+        if (!soft_equal(log_delta, std::log(vec[i + 1] / vec[i])))
+            return false;
+    }
+    return true;
+}
+
+bool is_increasing(SpanConstReal vec)
+{
+    for (auto i : range(vec.size() - 1))
+    {
+        if (!(vec[i + 1] > vec[i]))
+            return false;
+    }
+    return true;
+}
+
 bool is_on_grid_point(real_type value, real_type lo, real_type hi, size_type size)
 {
     if (value < lo || value > hi)
@@ -49,6 +79,33 @@ bool is_on_grid_point(real_type value, real_type lo, real_type hi, size_type siz
     return soft_zero(std::fmod(value - lo, delta));
 }
 
+//---------------------------------------------------------------------------//
+// Minimum density of a log grid for spline interpolation in linear energy
+constexpr real_type min_spline_points_per_decade = 5;
+
+real_type points_per_decade(real_type emin, real_type emax, size_type size)
+{
+    return (size - 1) / std::log10(emax / emin);
+}
+
+//---------------------------------------------------------------------------//
+bool is_same_grid(const UniformGridPointers& a, const UniformGridPointers& b)
+{
+    return a.size == b.size && a.front == b.front && a.back == b.back;
+}
+
+//---------------------------------------------------------------------------//
+// Unscaled cross section at a grid point
+real_type grid_xs(const XsGridPointers& xs, size_type i)
+{
+    real_type result = xs.value[i];
+    if (i >= xs.prime_index)
+    {
+        result /= std::exp(UniformGrid(xs.log_energy)[i]);
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace
 
@@ -129,10 +186,13 @@ auto ValueGridXsBuilder::value_storage() const -> ValueStorage
 
 //---------------------------------------------------------------------------//
 /*!
- * Construct on device.
+ * Add the grid to the packed table storage.
  */
-void ValueGridXsBuilder::build(ValueGridStore*) const
+ValueGridId
+ValueGridXsBuilder::build(ValueGridType type, ValueGridStore* store) const
 {
+    CELER_EXPECT(store);
+
     // Set up log grid
     auto log_energy
         = UniformGridPointers::from_bounds(log_emin_, log_emax_, xs_.size());
@@ -140,8 +200,277 @@ void ValueGridXsBuilder::build(ValueGridStore*) const
     size_type   prime_index = grid.find(log_eprime_);
     CELER_ASSERT(soft_equal(grid[prime_index], log_eprime_));
 
-    // TODO: finish implementation
-    CELER_NOT_IMPLEMENTED("value grid construction");
+    return store->push_back(type, log_energy, prime_index, make_span(xs_));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from imported energy loss or range data.
+ *
+ * The energy grid must be uniform in log(E), as is the case for the Geant4
+ * dE/dx and range tables; nonuniform data should be constructed with \c
+ * from_free.
+ */
+ValueGridLogBuilder ValueGridLogBuilder::from_geant(SpanConstReal energy,
+                                                    SpanConstReal value)
+{
+    CELER_EXPECT(is_log_spaced(energy));
+    CELER_EXPECT(value.size() == energy.size());
+    CELER_EXPECT(is_nonnegative(value));
+
+    return {energy.front(),
+            energy.back(),
+            std::vector<real_type>(value.begin(), value.end())};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a range table from imported inverse range data.
+ *
+ * The Geant4 inverse range table is the range table with its axes swapped:
+ * the x values are ranges and the y values are the (log-spaced) energies.
+ * Since \c InverseRangeCalculator uses the range table directly, the inverse
+ * range data is converted back to a range table.
+ */
+ValueGridLogBuilder
+ValueGridLogBuilder::from_inverse_range(SpanConstReal range,
+                                        SpanConstReal energy)
+{
+    CELER_EXPECT(is_log_spaced(energy));
+    CELER_EXPECT(range.size() == energy.size());
+    CELER_EXPECT(range.front() > 0 && is_increasing(range));
+
+    return {energy.front(),
+            energy.back(),
+            std::vector<real_type>(range.begin(), range.end())};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by resampling an imported free physics vector.
+ *
+ * Vectors with nonuniform energy spacing, such as the Livermore photoelectric
+ * cross sections, are interpolated onto the coarsest grid uniform in log(E)
+ * that reproduces the input within the resampling tolerance.
+ */
+ValueGridLogBuilder
+ValueGridLogBuilder::from_free(const ImportPhysicsVector&       vec,
+                               const LogGridResampler::Options& opts)
+{
+    CELER_EXPECT(vec.vector_type == ImportPhysicsVectorType::free);
+    CELER_EXPECT(is_nonnegative(make_span(vec.y)));
+
+    ResampledGrid grid
+        = LogGridResampler(opts)(make_span(vec.x), make_span(vec.y));
+    return {vec.x.front(), vec.x.back(), std::move(grid.value)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from raw data.
+ *
+ * The spline is calculated in linear energy, so adjacent bins of a log grid
+ * have very different widths. On grids with fewer than five points per
+ * decade, the interpolant can overshoot badly between grid points and even
+ * become negative, so coarser spline tables are rejected.
+ */
+ValueGridLogBuilder::ValueGridLogBuilder(real_type              emin,
+                                         real_type              emax,
+                                         std::vector<real_type> value,
+                                         ValueCalculation       calc)
+    : log_emin_(std::log(emin))
+    , log_emax_(std::log(emax))
+    , value_(std::move(value))
+    , calc_(calc)
+{
+    CELER_EXPECT(emin > 0);
+    CELER_EXPECT(emax > emin);
+    CELER_EXPECT(value_.size() >= 2);
+    CELER_EXPECT(calc == ValueCalculation::linear
+                 || calc == ValueCalculation::spline);
+
+    if (calc == ValueCalculation::spline)
+    {
+        real_type density = points_per_decade(emin, emax, value_.size());
+        CELER_VALIDATE(density > min_spline_points_per_decade
+                           || soft_equal(min_spline_points_per_decade,
+                                         density),
+                       "Spline interpolation requires at least "
+                           << min_spline_points_per_decade
+                           << " grid points per decade (got " << density
+                           << ")");
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the storage type and requirements for the energy grid.
+ */
+auto ValueGridLogBuilder::energy_storage() const -> EnergyStorage
+{
+    return {EnergyLookup::uniform_log, 0};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the storage type and requirements for the value grid.
+ */
+auto ValueGridLogBuilder::value_storage() const -> ValueStorage
+{
+    size_type num_values = value_.size();
+    if (calc_ == ValueCalculation::spline)
+    {
+        num_values *= 2;
+    }
+    return {calc_, num_values};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the grid to the packed table storage.
+ *
+ * Range tables must be strictly increasing so that they can be inverted. They
+ * must also be linearly interpolated: \c InverseRangeCalculator inverts the
+ * linear interpolant, and a cubic spline is not guaranteed to be monotonic.
+ */
+ValueGridId
+ValueGridLogBuilder::build(ValueGridType type, ValueGridStore* store) const
+{
+    CELER_EXPECT(store);
+    CELER_EXPECT(type != ValueGridType::range
+                 || (calc_ == ValueCalculation::linear
+                     && is_increasing(make_span(value_))));
+
+    auto log_energy
+        = UniformGridPointers::from_bounds(log_emin_, log_emax_, value_.size());
+
+    std::vector<real_type> deriv2;
+    if (calc_ == ValueCalculation::spline)
+    {
+        // Calculate second derivatives with respect to linear energy
+        std::vector<real_type> energy(value_.size());
+        UniformGrid            loge_grid(log_energy);
+        for (auto i : range(energy.size()))
+        {
+            energy[i] = std::exp(loge_grid[i]);
+        }
+        SplineDerivCalculator calc_deriv(
+            SplineDerivCalculator::BoundaryCondition::not_a_knot);
+        deriv2 = calc_deriv(make_span(energy), make_span(value_));
+    }
+
+    return store->push_back(type,
+                            log_energy,
+                            size_type(-1),
+                            make_span(value_),
+                            make_span(deriv2));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from host cross section tables of each process.
+ *
+ * The total is stored scaled by E above the highest "prime energy" of the
+ * processes, where it is exactly interpolated if all processes are scaled.
+ *
+ * Where the total cross section is zero (below all thresholds), the process
+ * fractions are copied from the next grid point above so that the fractions
+ * in the lowest bin with a nonzero cross section are consistent.
+ */
+ValueGridTotalXsBuilder::ValueGridTotalXsBuilder(SpanConstXs tables)
+    : prime_index_(0), num_processes_(tables.size())
+{
+    CELER_EXPECT(!tables.empty());
+
+    log_energy_ = tables.front().log_energy;
+    for (const XsGridPointers& xs : tables)
+    {
+        CELER_EXPECT(xs);
+        CELER_VALIDATE(is_same_grid(xs.log_energy, log_energy_),
+                       "Process cross sections for a total cross section "
+                       "table must share the same energy grid");
+        CELER_VALIDATE(xs.deriv2.empty(),
+                       "Process cross sections for a total cross section "
+                       "table must be linearly interpolated");
+        prime_index_ = std::max(prime_index_, xs.prime_index);
+    }
+
+    const size_type num_points = log_energy_.size;
+    const size_type num_cdf    = num_processes_ - 1;
+    total_.assign(num_points, 0);
+    cdf_.assign(num_points * num_cdf, 0);
+
+    std::vector<real_type> xs(num_processes_);
+    for (auto i : range(num_points))
+    {
+        // Accumulate cross sections
+        real_type total = 0;
+        for (auto p : range(num_processes_))
+        {
+            total += grid_xs(tables[p], i);
+            xs[p] = total;
+        }
+        total_[i] = total;
+        if (total > 0)
+        {
+            for (auto p : range(num_cdf))
+            {
+                cdf_[i * num_cdf + p] = xs[p] / total;
+            }
+        }
+    }
+
+    // Fill fractions where the total is zero, and scale by energy
+    UniformGrid grid(log_energy_);
+    for (auto j : range(num_points))
+    {
+        size_type i = num_points - 1 - j;
+        if (total_[i] == 0 && i + 1 < num_points)
+        {
+            std::copy(cdf_.begin() + (i + 1) * num_cdf,
+                      cdf_.begin() + (i + 2) * num_cdf,
+                      cdf_.begin() + i * num_cdf);
+        }
+        if (i >= prime_index_)
+        {
+            total_[i] *= std::exp(grid[i]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the storage type and requirements for the energy grid.
+ */
+auto ValueGridTotalXsBuilder::energy_storage() const -> EnergyStorage
+{
+    return {EnergyLookup::uniform_log, 0};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the storage type and requirements for the value grid.
+ */
+auto ValueGridTotalXsBuilder::value_storage() const -> ValueStorage
+{
+    return {ValueCalculation::linear_scaled, total_.size() + cdf_.size()};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the grid to the packed table storage.
+ */
+ValueGridId
+ValueGridTotalXsBuilder::build(ValueGridType type, ValueGridStore* store) const
+{
+    CELER_EXPECT(type == ValueGridType::total_xs);
+    CELER_EXPECT(store);
+
+    return store->push_back_total(log_energy_,
+                                  prime_index_,
+                                  make_span(total_),
+                                  num_processes_,
+                                  make_span(cdf_));
 }
 
 //---------------------------------------------------------------------------//
@@ -10,9 +10,13 @@
 #include <vector>
 #include "base/Span.hh"
 #include "base/Types.hh"
+#include "LogGridResampler.hh"
+#include "ValueGridType.hh"
+#include "XsGridPointers.hh"
 
 namespace celeritas
 {
+struct ImportPhysicsVector;
 class ValueGridStore;
 //---------------------------------------------------------------------------//
 //! Parameterization of the energy grid values for a physics array
@@ -27,6 +31,7 @@ enum class ValueCalculation
 {
     linear,        //!< Linear interpolation in value
     linear_scaled, //!< Linear interpolation, then divide by energy above E'
+    spline,        //!< Cubic spline interpolation in energy
 };
 
 //---------------------------------------------------------------------------//
@@ -53,9 +58,9 @@ class ValueGridBuilder
   public:
     virtual ~ValueGridBuilder() = 0;
 
-    virtual EnergyStorage energy_storage() const       = 0;
-    virtual ValueStorage  value_storage() const        = 0;
-    virtual void          build(ValueGridStore*) const = 0;
+    virtual EnergyStorage energy_storage() const = 0;
+    virtual ValueStorage  value_storage() const  = 0;
+    virtual ValueGridId   build(ValueGridType, ValueGridStore*) const = 0;
 };
 
 //---------------------------------------------------------------------------//
@@ -92,7 +97,8 @@ class ValueGridXsBuilder final : public ValueGridBuilder
     // Get the storage type and requirements for the value grid.
     ValueStorage value_storage() const final;
 
-    void build(ValueGridStore*) const final;
+    // Add the grid to the packed table storage
+    ValueGridId build(ValueGridType type, ValueGridStore* store) const final;
 
   private:
     real_type              log_emin_;
@@ -101,18 +107,109 @@ class ValueGridXsBuilder final : public ValueGridBuilder
     std::vector<real_type> xs_;
 };
 
-// TODO: implement ValueGridLogBuilder
-#if 0
 //---------------------------------------------------------------------------//
 /*!
  * Build a physics vector for energy loss and other quantities.
  *
- * This vector has a uniform grid in log(E).
+ * This vector has a uniform grid in log(E) and values that are interpolated
+ * linearly in energy. It's used for the stopping power (dE/dx) and the range
+ * of charged particles; the range table also provides the inverse range
+ * (energy as a function of range) without a separate table.
+ *
+ * With \c ValueCalculation::spline, the second derivatives of a cubic spline
+ * are stored alongside the values, so that a much coarser grid gives the same
+ * accuracy for smooth functions. The grid must have at least five points per
+ * decade for the spline to be well-behaved. Range tables must be linear so
+ * that they can be inverted exactly.
  */
 class ValueGridLogBuilder final : public ValueGridBuilder
 {
+  public:
+    //!@{
+    //! Type aliases
+    using SpanConstReal = Span<const real_type>;
+    //!@}
+
+  public:
+    // Construct from imported energy loss or range data
+    static ValueGridLogBuilder
+    from_geant(SpanConstReal energy, SpanConstReal value);
+
+    // Construct a range table from imported inverse range data
+    static ValueGridLogBuilder
+    from_inverse_range(SpanConstReal range, SpanConstReal energy);
+
+    // Construct by resampling an imported free physics vector
+    static ValueGridLogBuilder
+    from_free(const ImportPhysicsVector&       vec,
+              const LogGridResampler::Options& opts = {});
+
+    // Construct
+    ValueGridLogBuilder(real_type              emin,
+                        real_type              emax,
+                        std::vector<real_type> value,
+                        ValueCalculation       calc = ValueCalculation::linear);
+
+    // Get the storage type and requirements for the energy grid.
+    EnergyStorage energy_storage() const final;
+
+    // Get the storage type and requirements for the value grid.
+    ValueStorage value_storage() const final;
+
+    // Add the grid to the packed table storage
+    ValueGridId build(ValueGridType type, ValueGridStore* store) const final;
+
+  private:
+    real_type              log_emin_;
+    real_type              log_emax_;
+    std::vector<real_type> value_;
+    ValueCalculation       calc_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the total cross section over all processes of a particle in a material.
+ *
+ * The per-process macroscopic cross section tables, which must share a single
+ * log-energy grid (see \c ValueGridLogBuilder::from_free for resampling free
+ * vectors), are summed at each grid point. The cumulative fraction of the
+ * total due to each process is stored on the same grid so that a single \c
+ * TotalXsCalculator lookup provides both the total cross section for sampling
+ * the distance to interaction and the selection of the interacting process.
+ * The process tables must be linearly interpolated so that the total and the
+ * process fractions are consistent with the individual cross sections.
+ *
+ * The tables are evaluated at construction, so the builder remains valid if
+ * the store they're in is later modified.
+ */
+class ValueGridTotalXsBuilder final : public ValueGridBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SpanConstXs = Span<const XsGridPointers>;
+    //!@}
+
+  public:
+    // Construct from host cross section tables of each process
+    explicit ValueGridTotalXsBuilder(SpanConstXs tables);
+
+    // Get the storage type and requirements for the energy grid.
+    EnergyStorage energy_storage() const final;
+
+    // Get the storage type and requirements for the value grid.
+    ValueStorage value_storage() const final;
+
+    // Add the grid to the packed table storage
+    ValueGridId build(ValueGridType type, ValueGridStore* store) const final;
+
+  private:
+    UniformGridPointers    log_energy_;
+    size_type              prime_index_;
+    size_type              num_processes_;
+    std::vector<real_type> total_;
+    std::vector<real_type> cdf_;
 };
-#endif
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas
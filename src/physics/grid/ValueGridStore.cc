@@ -0,0 +1,385 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ValueGridStore.cc
+//---------------------------------------------------------------------------//
+#include "ValueGridStore.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Number of values per aligned block
+constexpr size_type block_size
+    = ValueGridStore::alignment / sizeof(grid_real_type);
+static_assert(ValueGridStore::alignment % sizeof(grid_real_type) == 0,
+              "Alignment must be a multiple of the value size");
+
+//---------------------------------------------------------------------------//
+// FNV-1a hash of the bytes of an array
+size_type hash_bytes(Span<const grid_real_type> values)
+{
+    std::uint64_t result = 0xcbf29ce484222325ull;
+    const auto* bytes = reinterpret_cast<const unsigned char*>(values.data());
+    for (auto i : range(values.size() * sizeof(grid_real_type)))
+    {
+        result ^= bytes[i];
+        result *= 0x100000001b3ull;
+    }
+    return static_cast<size_type>(result);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Max relative difference between interpolated stored and input values.
+ *
+ * Values are compared at each grid point and at the midpoint of each bin.
+ * Values much smaller than the largest value in the table are compared
+ * absolutely.
+ */
+real_type calc_storage_error(Span<const real_type>      energy,
+                             Span<const real_type>      value,
+                             Span<const grid_real_type> stored_energy,
+                             Span<const grid_real_type> stored_value)
+{
+    CELER_EXPECT(energy.size() == value.size());
+    CELER_EXPECT(stored_energy.size() == energy.size());
+    CELER_EXPECT(stored_value.size() == value.size());
+
+    real_type abs_value = 0;
+    for (real_type v : value)
+    {
+        abs_value = std::max(abs_value, std::fabs(v));
+    }
+    abs_value *= std::numeric_limits<grid_real_type>::epsilon();
+
+    auto calc_error = [abs_value](real_type actual, real_type expected) {
+        real_type denom = std::max(std::fabs(expected), abs_value);
+        return denom > 0 ? std::fabs(actual - expected) / denom : 0;
+    };
+
+    real_type result = 0;
+    for (auto i : range(value.size()))
+    {
+        result = std::max(result, calc_error(stored_value[i], value[i]));
+        if (i + 1 == value.size())
+            break;
+
+        // Interpolate both at the same energy
+        real_type e_mid    = (energy[i] + energy[i + 1]) / 2;
+        real_type expected = value[i]
+                             + (e_mid - energy[i])
+                                   * (value[i + 1] - value[i])
+                                   / (energy[i + 1] - energy[i]);
+        real_type e_lo   = stored_energy[i];
+        real_type e_hi   = stored_energy[i + 1];
+        real_type v_lo   = stored_value[i];
+        real_type v_hi   = stored_value[i + 1];
+        real_type actual = v_lo
+                           + (e_mid - e_lo) * (v_hi - v_lo) / (e_hi - e_lo);
+        result = std::max(result, calc_error(actual, expected));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the string value for a table type.
+ */
+const char* to_cstring(ValueGridType value)
+{
+    static const char* const strings[] = {
+        "macro_xs",
+        "energy_loss",
+        "range",
+        "total_xs",
+    };
+    CELER_EXPECT(static_cast<int>(value) * sizeof(const char*)
+                 < sizeof(strings));
+    return strings[static_cast<int>(value)];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a table that is uniform in log(E).
+ *
+ * For all grid points at or above \c prime_index, the values are expected to
+ * be pre-scaled by the energy; use \c size_type(-1) if no values are scaled.
+ * If spline second derivatives are given, the values must not be scaled.
+ */
+ValueGridId ValueGridStore::push_back(ValueGridType              type,
+                                      const UniformGridPointers& log_energy,
+                                      size_type                  prime_index,
+                                      SpanConstReal              values,
+                                      SpanConstReal              deriv2)
+{
+    CELER_EXPECT(type != ValueGridType::size_);
+    CELER_EXPECT(log_energy);
+    CELER_EXPECT(values.size() == log_energy.size);
+    CELER_EXPECT(prime_index < values.size() || prime_index == size_type(-1));
+    CELER_EXPECT(deriv2.empty()
+                 || (deriv2.size() == values.size()
+                     && prime_index == size_type(-1)));
+    CELER_EXPECT(!this->has_device_data());
+
+    // Calculate grid point energies
+    std::vector<real_type> energy(log_energy.size);
+    UniformGrid            loge_grid(log_energy);
+    for (auto i : range(energy.size()))
+    {
+        energy[i] = std::exp(loge_grid[i]);
+    }
+
+    // Convert to storage precision
+    std::vector<grid_real_type> stored_value(values.begin(), values.end());
+    std::vector<grid_real_type> stored_energy(energy.begin(), energy.end());
+
+    GridRecord record;
+    record.log_energy  = log_energy;
+    record.prime_index = prime_index;
+    record.value       = this->insert_unique(type, make_span(stored_value));
+    record.energy      = this->insert_unique(type, make_span(stored_energy));
+    record.deriv2      = {0, 0};
+    if (!deriv2.empty())
+    {
+        std::vector<grid_real_type> stored_deriv2(deriv2.begin(), deriv2.end());
+        record.deriv2 = this->insert_unique(type, make_span(stored_deriv2));
+    }
+    record.num_processes = 0;
+    record.cdf           = {0, 0};
+    grids_.push_back(record);
+
+    ValueGridUsage& usage = usage_[static_cast<size_type>(type)];
+    ++usage.num_grids;
+    usage.max_error = std::max(usage.max_error,
+                               calc_storage_error(make_span(energy),
+                                                  values,
+                                                  make_span(stored_energy),
+                                                  make_span(stored_value)));
+
+    return ValueGridId(grids_.size() - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a total cross section table with cumulative process fractions.
+ *
+ * The \c cdf values are stored point by point, with \code num_processes - 1
+ * \endcode values per grid point (see \c TotalXsGridPointers).
+ */
+ValueGridId
+ValueGridStore::push_back_total(const UniformGridPointers& log_energy,
+                                size_type                  prime_index,
+                                SpanConstReal              total,
+                                size_type                  num_processes,
+                                SpanConstReal              cdf)
+{
+    CELER_EXPECT(num_processes > 0);
+    CELER_EXPECT(cdf.size() == total.size() * (num_processes - 1));
+
+    ValueGridId result = this->push_back(
+        ValueGridType::total_xs, log_energy, prime_index, total);
+
+    GridRecord& record   = grids_.back();
+    record.num_processes = num_processes;
+    if (!cdf.empty())
+    {
+        std::vector<grid_real_type> stored_cdf(cdf.begin(), cdf.end());
+        record.cdf = this->insert_unique(ValueGridType::total_xs,
+                                         make_span(stored_cdf));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the packed data to the device in a single transfer.
+ *
+ * No more tables can be inserted afterward.
+ */
+void ValueGridStore::copy_to_device()
+{
+    CELER_EXPECT(!host_.empty());
+    CELER_EXPECT(!this->has_device_data());
+
+    DeviceVector<grid_real_type> device(host_.size());
+    device.copy_to_device(make_span(host_));
+    device_ = std::move(device);
+
+    CELER_ENSURE(this->has_device_data());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a table in host memory.
+ *
+ * Host pointers are invalidated by subsequent insertions.
+ */
+XsGridPointers ValueGridStore::host_pointers(ValueGridId id) const
+{
+    return this->pointers(host_.data(), id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a table in device memory.
+ */
+XsGridPointers ValueGridStore::device_pointers(ValueGridId id) const
+{
+    CELER_EXPECT(this->has_device_data());
+    return this->pointers(device_.device_pointers().data(), id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a total cross section table in host memory.
+ *
+ * Host pointers are invalidated by subsequent insertions.
+ */
+TotalXsGridPointers ValueGridStore::host_total_pointers(ValueGridId id) const
+{
+    return this->total_pointers(host_.data(), id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a total cross section table in device memory.
+ */
+TotalXsGridPointers ValueGridStore::device_total_pointers(ValueGridId id) const
+{
+    CELER_EXPECT(this->has_device_data());
+    return this->total_pointers(device_.device_pointers().data(), id);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Memory used by a single table type.
+ */
+const ValueGridUsage& ValueGridStore::usage(ValueGridType type) const
+{
+    CELER_EXPECT(type != ValueGridType::size_);
+    return usage_[static_cast<size_type>(type)];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find or append an array of values.
+ */
+auto ValueGridStore::insert_unique(ValueGridType type, SpanConstValue values)
+    -> Slot
+{
+    CELER_EXPECT(!values.empty());
+
+    // Look for an existing identical array
+    auto& candidates = slots_by_hash_[hash_bytes(values)];
+    for (const Slot& slot : candidates)
+    {
+        if (slot.size == values.size()
+            && std::memcmp(host_.data() + slot.offset,
+                           values.data(),
+                           values.size() * sizeof(grid_real_type))
+                   == 0)
+        {
+            return slot;
+        }
+    }
+
+    // Append, padding the end to the next aligned boundary
+    Slot result;
+    result.offset = host_.size();
+    result.size   = values.size();
+    size_type padded_size
+        = (values.size() + block_size - 1) / block_size * block_size;
+    host_.resize(result.offset + padded_size, grid_real_type(0));
+    std::copy(values.begin(), values.end(), host_.begin() + result.offset);
+    candidates.push_back(result);
+
+    ValueGridUsage& usage = usage_[static_cast<size_type>(type)];
+    ++usage.num_arrays;
+    usage.num_bytes += padded_size * sizeof(grid_real_type);
+
+    CELER_ENSURE(result.offset % block_size == 0);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct pointers to a table from a base address.
+ */
+XsGridPointers
+ValueGridStore::pointers(const grid_real_type* base, ValueGridId id) const
+{
+    CELER_EXPECT(base);
+    CELER_EXPECT(id < grids_.size());
+    const GridRecord& record = grids_[id.get()];
+
+    XsGridPointers result;
+    result.log_energy  = record.log_energy;
+    result.prime_index = record.prime_index;
+    result.value  = {base + record.value.offset, record.value.size};
+    result.energy = {base + record.energy.offset, record.energy.size};
+    result.deriv2 = {base + record.deriv2.offset, record.deriv2.size};
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct pointers to a total cross section table from a base address.
+ */
+TotalXsGridPointers
+ValueGridStore::total_pointers(const grid_real_type* base, ValueGridId id) const
+{
+    CELER_EXPECT(id < grids_.size());
+    const GridRecord& record = grids_[id.get()];
+    CELER_EXPECT(record.num_processes > 0);
+
+    TotalXsGridPointers result;
+    result.total         = this->pointers(base, id);
+    result.num_processes = record.num_processes;
+    result.cdf           = {base + record.cdf.offset, record.cdf.size};
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the memory usage of each table type as JSON.
+ */
+void write_json(std::ostream& os, const ValueGridStore& store)
+{
+    os << "{\"num_bytes\":" << store.num_bytes() << ",\"tables\":{";
+    for (auto i : range(static_cast<int>(ValueGridType::size_)))
+    {
+        auto                  type  = static_cast<ValueGridType>(i);
+        const ValueGridUsage& usage = store.usage(type);
+        if (i > 0)
+        {
+            os << ',';
+        }
+        os << '"' << to_cstring(type) << "\":{\"num_grids\":"
+           << usage.num_grids << ",\"num_arrays\":" << usage.num_arrays
+           << ",\"num_bytes\":" << usage.num_bytes
+           << ",\"max_error\":" << usage.max_error << '}';
+    }
+    os << "}}";
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
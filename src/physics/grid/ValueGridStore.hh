@@ -0,0 +1,163 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ValueGridStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+#include "base/AlignedHostAllocator.hh"
+#include "base/Array.hh"
+#include "base/DeviceVector.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "TotalXsGridPointers.hh"
+#include "ValueGridType.hh"
+#include "XsGridPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Memory used by the physics tables of a single type.
+ *
+ * Deduplicated data is attributed to the table type that first inserted it.
+ */
+struct ValueGridUsage
+{
+    size_type num_grids{0};  //!< Number of tables inserted
+    size_type num_arrays{0}; //!< Number of unique arrays stored
+    size_type num_bytes{0};  //!< Packed bytes of unique data, with padding
+    real_type max_error{0};  //!< Max relative error due to storage precision
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Packed storage for all physics tables.
+ *
+ * Grid values for every material, particle, and process are stored in a
+ * single contiguous arena that is copied to the device in one transfer. Each
+ * array starts on a cache-line boundary in both host and device memory, and
+ * arrays identical to a previously inserted one (Geant4 often repeats physics
+ * vectors across materials, and tables of the same process share an energy
+ * grid) are stored only once. The linear-energy grid points of each table are
+ * computed at insertion and stored alongside the values so that interpolation
+ * need not exponentiate.
+ *
+ * Tables are stored as \c grid_real_type, which is single precision if
+ * \c CELERITAS_FLOAT_TABLES is enabled. Each inserted table is then
+ * validated against its double-precision input: the interpolated values are
+ * compared at every grid point and bin midpoint, and the maximum relative
+ * difference is reported in the usage for its table type.
+ *
+ * \code
+    ValueGridStore store;
+    for (const auto& builder : builders)
+    {
+        ids.push_back(builder->build(ValueGridType::macro_xs, &store));
+    }
+    store.copy_to_device();
+    XsGridPointers xs = store.device_pointers(ids.front());
+   \endcode
+ */
+class ValueGridStore
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SpanConstReal  = Span<const real_type>;
+    using SpanConstValue = Span<const grid_real_type>;
+    //!@}
+
+    //! Alignment of each packed array, in bytes
+    static constexpr size_type alignment = 64;
+
+  public:
+    // Add a table that is uniform in log(E)
+    ValueGridId push_back(ValueGridType              type,
+                          const UniformGridPointers& log_energy,
+                          size_type                  prime_index,
+                          SpanConstReal              values,
+                          SpanConstReal              deriv2 = {});
+
+    // Add a total cross section table with cumulative process fractions
+    ValueGridId push_back_total(const UniformGridPointers& log_energy,
+                                size_type                  prime_index,
+                                SpanConstReal              total,
+                                size_type                  num_processes,
+                                SpanConstReal              cdf);
+
+    // Copy the packed data to the device in a single transfer
+    void copy_to_device();
+
+    //// ACCESSORS ////
+
+    //! Number of tables
+    size_type size() const { return grids_.size(); }
+
+    //! Total number of packed bytes, including padding
+    size_type num_bytes() const
+    {
+        return host_.size() * sizeof(grid_real_type);
+    }
+
+    //! Whether data has been copied to the device
+    bool has_device_data() const { return !device_.empty(); }
+
+    // Access a table in host memory
+    XsGridPointers host_pointers(ValueGridId id) const;
+
+    // Access a table in device memory
+    XsGridPointers device_pointers(ValueGridId id) const;
+
+    // Access a total cross section table in host memory
+    TotalXsGridPointers host_total_pointers(ValueGridId id) const;
+
+    // Access a total cross section table in device memory
+    TotalXsGridPointers device_total_pointers(ValueGridId id) const;
+
+    // Memory used by a single table type
+    const ValueGridUsage& usage(ValueGridType type) const;
+
+  private:
+    struct Slot
+    {
+        size_type offset;
+        size_type size;
+    };
+
+    struct GridRecord
+    {
+        UniformGridPointers log_energy;
+        size_type           prime_index;
+        Slot                value;
+        Slot                energy;
+        Slot                deriv2;
+        size_type           num_processes; //!< Nonzero for total xs tables
+        Slot                cdf;
+    };
+
+    using UsageArray = Array<ValueGridUsage, size_type(ValueGridType::size_)>;
+
+    AlignedHostVector<grid_real_type>                host_;
+    DeviceVector<grid_real_type>                     device_;
+    std::vector<GridRecord>                          grids_;
+    std::unordered_map<size_type, std::vector<Slot>> slots_by_hash_;
+    UsageArray                                       usage_{};
+
+    Slot insert_unique(ValueGridType type, SpanConstValue values);
+    XsGridPointers pointers(const grid_real_type* base, ValueGridId id) const;
+    TotalXsGridPointers
+    total_pointers(const grid_real_type* base, ValueGridId id) const;
+};
+
+//---------------------------------------------------------------------------//
+// Write the memory usage of each table type as JSON
+void write_json(std::ostream& os, const ValueGridStore& store);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,40 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ValueGridType.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/OpaqueId.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Quantity stored in a physics table.
+ *
+ * These correspond to the step limiter builders of a \c Process.
+ */
+enum class ValueGridType
+{
+    macro_xs,    //!< Macroscopic cross section [1/cm]
+    energy_loss, //!< dE/dx [MeV/cm]
+    range,       //!< Range limit [cm]
+    total_xs,    //!< Total macroscopic cross section over processes [1/cm]
+    size_
+};
+
+//! Opaque index to a physics table in a value grid store
+using ValueGridId = OpaqueId<struct ValueGridRecord>;
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Get the string value for a table type
+const char* to_cstring(ValueGridType value);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
 #include "base/Span.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
@@ -14,6 +15,22 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Storage type for tabulated physics data.
+ *
+ * Imported tables are only accurate to a few significant digits, so storing
+ * them in single precision (with the \c CELERITAS_FLOAT_TABLES option) halves
+ * their memory footprint and bandwidth at little cost in accuracy. Values are
+ * promoted to \c real_type as they are loaded, so interpolation and any
+ * accumulation over tables are done in full precision.
+ */
+#if CELERITAS_FLOAT_TABLES
+using grid_real_type = float;
+#else
+using grid_real_type = real_type;
+#endif
+
 //---------------------------------------------------------------------------//
 /*!
  * Parameterization of a discrete scalar field on a given 1D grid.
@@ -21,6 +38,15 @@ namespace celeritas
  * For all  \code i >= prime_index \endcode, the \code value[i] \endcode is
  * expected to be pre-scaled by a factor of \code energy[i] \endcode.
  *
+ * The optional \c energy array stores the grid points in linear energy
+ * (\code exp(log_energy[i]) \endcode) so that interpolation does not need to
+ * recompute them.
+ *
+ * The optional \c deriv2 array stores the second derivatives of the values
+ * with respect to energy for cubic spline interpolation (see \c
+ * SplineDerivCalculator). Splines are not supported on tables with scaled
+ * values.
+ *
  * \todo Later we will support multiple parameterizations of the x grid, and
  * possibly different interpolations on x and y. Currently interpolation is
  * linear-linear after transforming to log-E space and before scaling the value
@@ -31,9 +57,11 @@ struct XsGridPointers
     using EnergyUnits = units::Mev;
     using XsUnits     = units::NativeUnit; // 1/cm
 
-    UniformGridPointers   log_energy;
-    size_type             prime_index{size_type(-1)};
-    Span<const real_type> value;
+    UniformGridPointers        log_energy;
+    size_type                  prime_index{size_type(-1)};
+    Span<const grid_real_type> value;
+    Span<const grid_real_type> energy; //!< Optional grid point energies [MeV]
+    Span<const grid_real_type> deriv2; //!< Optional spline second derivatives
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -41,7 +69,11 @@ struct XsGridPointers
         return log_energy && !value.empty()
                && (prime_index < log_energy.size
                    || prime_index == size_type(-1))
-               && log_energy.size == value.size();
+               && log_energy.size == value.size()
+               && (energy.empty() || energy.size() == value.size())
+               && (deriv2.empty()
+                   || (deriv2.size() == value.size()
+                       && prime_index == size_type(-1)));
     }
 };
 
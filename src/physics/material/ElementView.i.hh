@@ -15,7 +15,7 @@ namespace celeritas
 CELER_FUNCTION
 ElementView::ElementView(const MaterialParamsPointers& params,
                          ElementDefId                  el_id)
-    : def_(params.elements[el_id.get()])
+    : def_(params.elements[el_id])
 {
     CELER_EXPECT(el_id < params.elements.size());
 }
@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "base/Span.hh"
+#include "base/Collection.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
 #include "ElementDef.hh"
@@ -33,15 +33,16 @@ struct MatElementComponent
  *
  * Multiple material definitions are allowed to reuse a single element
  * definition vector (memory management from the params store should handle
- * this). Derivative properties such as electron_density are calculated from
- * the elemental components.
+ * this). The elemental components are a range of items in the params
+ * \c elcomponents collection. Derivative properties such as electron_density
+ * are calculated from the elemental components.
  */
 struct MaterialDef
 {
     real_type   number_density; //!< Atomic number density [1/cm^3]
     real_type   temperature;    //!< Temperature [K]
     MatterState matter_state;   //!< Solid, liquid, gas
-    Span<const MatElementComponent> elements; //!< Access by ElementComponentId
+    ItemRange<MatElementComponent> elements; //!< Access by ElementComponentId
 
     // COMPUTED PROPERTIES
 
@@ -11,10 +11,9 @@
 #include <cmath>
 #include <numeric>
 #include "detail/Utils.hh"
+#include "base/CollectionBuilder.hh"
 #include "base/Range.hh"
 #include "base/SoftEqual.hh"
-#include "base/SpanRemapper.hh"
-#include "comm/Device.hh"
 #include "comm/Logger.hh"
 
 namespace celeritas
@@ -27,58 +26,38 @@ MaterialParams::MaterialParams(const Input& inp) : max_el_(0)
 {
     CELER_EXPECT(!inp.materials.empty());
 
-    // Reserve host space (MUST reserve elcomponents to avoid invalidating
-    // spans).
-    host_elements_.reserve(inp.elements.size());
-    host_elcomponents_.reserve(
+    // Reserve host space
+    HostData data;
+    data.elements.reserve(inp.elements.size());
+    data.elcomponents.reserve(
         std::accumulate(inp.materials.begin(),
                         inp.materials.end(),
                         size_type(0),
                         [](size_type count, const MaterialInput& mi) {
                             return count + mi.elements_fractions.size();
                         }));
-    host_materials_.reserve(inp.materials.size());
+    data.materials.reserve(inp.materials.size());
     elnames_.reserve(inp.elements.size());
     matnames_.reserve(inp.materials.size());
 
     // Build elements and materials on host.
     for (const auto& el : inp.elements)
     {
-        this->append_element_def(el);
+        this->append_element_def(el, &data);
     }
     for (const auto& mat : inp.materials)
     {
-        this->append_material_def(mat);
+        this->append_material_def(mat, &data);
     }
 
-    if (celeritas::is_device_enabled())
-    {
-        // Allocate device vectors
-        device_elements_ = DeviceVector<ElementDef>{host_elements_.size()};
-        device_elcomponents_
-            = DeviceVector<MatElementComponent>{host_elcomponents_.size()};
-        device_materials_ = DeviceVector<MaterialDef>{host_materials_.size()};
-
-        // Remap material->elcomponent spans
-        auto remap_elements
-            = make_span_remapper(make_span(host_elcomponents_),
-                                 device_elcomponents_.device_pointers());
-
-        std::vector<MaterialDef> temp_device_mats = host_materials_;
-        for (MaterialDef& m : temp_device_mats)
-        {
-            m.elements = remap_elements(m.elements);
-        }
+    // Pack host data and copy to device
+    elements_     = arena_.insert(make_span(data.elements));
+    elcomponents_ = arena_.insert(make_span(data.elcomponents));
+    materials_    = arena_.insert(make_span(data.materials));
+    arena_.copy_to_device();
 
-        // Copy vectors to device
-        device_elements_.copy_to_device(make_span(host_elements_));
-        device_elcomponents_.copy_to_device(make_span(host_elcomponents_));
-        device_materials_.copy_to_device(make_span(temp_device_mats));
-    }
-
-    CELER_ENSURE(host_elements_.size() == inp.elements.size());
-    CELER_ENSURE(host_elcomponents_.size() <= host_elcomponents_.capacity());
-    CELER_ENSURE(host_materials_.size() == inp.materials.size());
+    CELER_ENSURE(elements_.size == inp.elements.size());
+    CELER_ENSURE(materials_.size == inp.materials.size());
     CELER_ENSURE(elnames_.size() == inp.elements.size());
     CELER_ENSURE(matnames_.size() == inp.materials.size());
 }
@@ -90,8 +69,11 @@ MaterialParams::MaterialParams(const Input& inp) : max_el_(0)
 MaterialParamsPointers MaterialParams::host_pointers() const
 {
     MaterialParamsPointers result;
-    result.elements               = make_span(host_elements_);
-    result.materials              = make_span(host_materials_);
+    result.elements = Collection<const ElementDef>(arena_.host_view(elements_));
+    result.elcomponents = Collection<const MatElementComponent>(
+        arena_.host_view(elcomponents_));
+    result.materials
+        = Collection<const MaterialDef>(arena_.host_view(materials_));
     result.max_element_components = this->max_element_components();
 
     CELER_ENSURE(result);
@@ -105,8 +87,12 @@ MaterialParamsPointers MaterialParams::host_pointers() const
 MaterialParamsPointers MaterialParams::device_pointers() const
 {
     MaterialParamsPointers result;
-    result.elements               = device_elements_.device_pointers();
-    result.materials              = device_materials_.device_pointers();
+    result.elements
+        = Collection<const ElementDef>(arena_.device_view(elements_));
+    result.elcomponents = Collection<const MatElementComponent>(
+        arena_.device_view(elcomponents_));
+    result.materials
+        = Collection<const MaterialDef>(arena_.device_view(materials_));
     result.max_element_components = this->max_element_components();
 
     CELER_ENSURE(result);
@@ -122,7 +108,8 @@ MaterialParamsPointers MaterialParams::device_pointers() const
  * This adds computed quantities in addition to the input values. The result
  * is pushed back onto the host list of stored elements.
  */
-void MaterialParams::append_element_def(const ElementInput& inp)
+void MaterialParams::append_element_def(const ElementInput& inp,
+                                        HostData*           data)
 {
     CELER_EXPECT(inp.atomic_number > 0);
     CELER_EXPECT(inp.atomic_mass > zero_quantity());
@@ -145,7 +132,7 @@ void MaterialParams::append_element_def(const ElementInput& inp)
     elnames_.push_back(inp.name);
 
     // Add to host vector
-    host_elements_.push_back(result);
+    data->elements.push_back(result);
 }
 
 //---------------------------------------------------------------------------//
@@ -155,23 +142,20 @@ void MaterialParams::append_element_def(const ElementInput& inp)
  * \todo It's the caller's responsibility to ensure that element IDs
  * aren't duplicated.
  */
-Span<MatElementComponent>
-MaterialParams::extend_elcomponents(const MaterialInput& inp)
+ItemRange<MatElementComponent>
+MaterialParams::extend_elcomponents(const MaterialInput& inp, HostData* data)
 {
-    CELER_EXPECT(host_elcomponents_.size() + inp.elements_fractions.size()
-                 <= host_elcomponents_.capacity());
-
     // Allocate material components
-    auto start_size = host_elcomponents_.size();
-    host_elcomponents_.resize(start_size + inp.elements_fractions.size());
-    Span<MatElementComponent> result{host_elcomponents_.data() + start_size,
-                                     inp.elements_fractions.size()};
+    auto build_elcomponents = make_builder(&data->elcomponents);
+    ItemRange<MatElementComponent> components
+        = build_elcomponents.resize_back(inp.elements_fractions.size());
+    Span<MatElementComponent> result = build_elcomponents[components];
 
     // Store number fractions
     real_type norm = 0.0;
     for (auto i : range(inp.elements_fractions.size()))
     {
-        CELER_EXPECT(inp.elements_fractions[i].first < host_elements_.size());
+        CELER_EXPECT(inp.elements_fractions[i].first < data->elements.size());
         CELER_EXPECT(inp.elements_fractions[i].second >= 0);
         // Store number fraction
         result[i].element  = inp.elements_fractions[i].first;
@@ -206,27 +190,28 @@ MaterialParams::extend_elcomponents(const MaterialInput& inp)
             return lhs.element < rhs.element;
         });
 
-    return result;
+    return components;
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Convert an material input to an material definition and store.
  */
-void MaterialParams::append_material_def(const MaterialInput& inp)
+void MaterialParams::append_material_def(const MaterialInput& inp,
+                                         HostData*            data)
 {
     CELER_EXPECT(inp.number_density >= 0);
     CELER_EXPECT((inp.number_density == 0) == inp.elements_fractions.empty());
 
     auto iter_inserted = matname_to_id_.insert(
-        {inp.name, MaterialDefId(host_materials_.size())});
+        {inp.name, MaterialDefId(data->materials.size())});
     if (!iter_inserted.second)
     {
         // Insertion failed, so material name is a duplicate
         CELER_LOG(warning)
             << "Material " << inp.name << " already exists with id "
             << iter_inserted.second << ". This new id ("
-            << host_materials_.size() << ") will not be available.";
+            << data->materials.size() << ") will not be available.";
     }
 
     MaterialDef result;
@@ -234,7 +219,7 @@ void MaterialParams::append_material_def(const MaterialInput& inp)
     result.number_density = inp.number_density;
     result.temperature    = inp.temperature;
     result.matter_state   = inp.matter_state;
-    result.elements       = this->extend_elcomponents(inp);
+    result.elements       = this->extend_elcomponents(inp, data);
 
     /*!
      * Calculate derived quantities: density, electron density, and rad length
@@ -244,10 +229,11 @@ void MaterialParams::append_material_def(const MaterialInput& inp)
     real_type avg_amu_mass = 0;
     real_type avg_z        = 0;
     real_type rad_coeff    = 0;
-    for (const MatElementComponent& comp : result.elements)
+    for (const MatElementComponent& comp :
+         make_builder(&data->elcomponents)[result.elements])
     {
-        CELER_ASSERT(comp.element < host_elements_.size());
-        const ElementDef& el = host_elements_[comp.element.get()];
+        CELER_ASSERT(comp.element < data->elements.size());
+        const ElementDef& el = data->elements[comp.element.get()];
 
         avg_amu_mass += comp.fraction * el.atomic_mass.value();
         avg_z += comp.fraction * el.atomic_number;
@@ -259,11 +245,11 @@ void MaterialParams::append_material_def(const MaterialInput& inp)
     result.rad_length       = 1 / (rad_coeff * result.density);
 
     // Add to host vector
-    host_materials_.push_back(result);
+    data->materials.push_back(result);
     matnames_.push_back(inp.name);
 
     // Update maximum number of materials
-    max_el_ = std::max(max_el_, result.elements.size());
+    max_el_ = std::max<size_type>(max_el_, result.elements.size());
 
     CELER_ENSURE(result.number_density >= 0);
     CELER_ENSURE(result.temperature >= 0);
@@ -11,7 +11,7 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
-#include "base/DeviceVector.hh"
+#include "base/CollectionArena.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
 #include "ElementDef.hh"
@@ -77,14 +77,22 @@ class MaterialParams
     //! Maximum number of elements in any one material
     size_type max_element_components() const { return max_el_; }
 
+    //! Packed host/device data
+    const CollectionArena& arena() const { return arena_; }
+
   private:
-    std::vector<ElementDef>          host_elements_;
-    std::vector<MatElementComponent> host_elcomponents_;
-    std::vector<MaterialDef>         host_materials_;
+    // Host data used during construction
+    struct HostData
+    {
+        std::vector<ElementDef>          elements;
+        std::vector<MatElementComponent> elcomponents;
+        std::vector<MaterialDef>         materials;
+    };
 
-    DeviceVector<ElementDef>          device_elements_;
-    DeviceVector<MatElementComponent> device_elcomponents_;
-    DeviceVector<MaterialDef>         device_materials_;
+    CollectionArena                arena_;
+    ArenaSlot<ElementDef>          elements_;
+    ArenaSlot<MatElementComponent> elcomponents_;
+    ArenaSlot<MaterialDef>         materials_;
 
     std::vector<std::string>                       elnames_;
     std::vector<std::string>                       matnames_;
@@ -92,9 +100,10 @@ class MaterialParams
     size_type                                      max_el_;
 
     // HELPER FUNCTIONS
-    void                      append_element_def(const ElementInput& inp);
-    Span<MatElementComponent> extend_elcomponents(const MaterialInput& inp);
-    void                      append_material_def(const MaterialInput& inp);
+    void append_element_def(const ElementInput& inp, HostData* data);
+    ItemRange<MatElementComponent>
+         extend_elcomponents(const MaterialInput& inp, HostData* data);
+    void append_material_def(const MaterialInput& inp, HostData* data);
 };
 
 //---------------------------------------------------------------------------//
@@ -8,7 +8,7 @@
 #pragma once
 
 #include "base/Macros.hh"
-#include "base/Span.hh"
+#include "base/Collection.hh"
 #include "ElementDef.hh"
 #include "MaterialDef.hh"
 
@@ -18,7 +18,8 @@ namespace celeritas
 /*!
  * Access material properties on the device.
  *
- * This view is created from \c MaterialParams.
+ * This view is created from \c MaterialParams. Materials refer to their
+ * elemental components by a range of items in \c elcomponents.
  *
  * \sa MaterialParams (owns the pointed-to data)
  * \sa ElementView (uses the pointed-to element data in a kernel)
@@ -26,9 +27,10 @@ namespace celeritas
  */
 struct MaterialParamsPointers
 {
-    Span<const ElementDef>  elements;
-    Span<const MaterialDef> materials;
-    size_type               max_element_components;
+    Collection<const ElementDef>          elements;
+    Collection<const MatElementComponent> elcomponents;
+    Collection<const MaterialDef>         materials;
+    size_type                             max_element_components;
 
     //! Check whether the interface is assigned
     explicit inline CELER_FUNCTION operator bool() const
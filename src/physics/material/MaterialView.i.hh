@@ -91,10 +91,9 @@ MaterialView::get_element_density(ElementComponentId id) const
 /*!
  * View the elemental components (id/fraction) of this material.
  */
-CELER_FUNCTION const Span<const MatElementComponent>&
-                     MaterialView::elements() const
+CELER_FUNCTION Span<const MatElementComponent> MaterialView::elements() const
 {
-    return this->material_def().elements;
+    return params_.elcomponents[this->material_def().elements];
 }
 
 //---------------------------------------------------------------------------//
@@ -132,7 +131,7 @@ CELER_FUNCTION real_type MaterialView::radiation_length() const
  */
 CELER_FUNCTION const MaterialDef& MaterialView::material_def() const
 {
-    return params_.materials[id_.get()];
+    return params_.materials[id_];
 }
 
 //---------------------------------------------------------------------------//
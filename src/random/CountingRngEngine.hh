@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CountingRngEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Wrap a random number engine to count the samples drawn from it.
+ *
+ * Unlike the test-only \c DiagnosticRngEngine this is usable on device and
+ * refers to (rather than owns) the wrapped engine, so it can be constructed
+ * around the engine of a track immediately before an interaction. Uniform
+ * real samples are forwarded to the \c GenerateCanonical of the wrapped
+ * engine, so the random stream is identical with and without the wrapper.
+ *
+ * Each call to \c operator() and each canonical real sample counts as one
+ * draw: the count is the number of uniform samples consumed by an algorithm,
+ * independent of how many bits each engine needs to produce them.
+ *
+ * \code
+    CountingRngEngine<RngEngine> counted_rng(rng);
+    Interaction result = interact(counted_rng);
+    record_draws(model_id, counted_rng.count());
+   \endcode
+ */
+template<class Engine>
+class CountingRngEngine
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = typename Engine::result_type;
+    using engine_type = Engine;
+    //!@}
+
+  public:
+    //! Construct with a reference to the engine
+    explicit CELER_FUNCTION CountingRngEngine(Engine& engine)
+        : engine_(engine)
+    {
+    }
+
+    //! Sample a random number and increment the draw count
+    CELER_FUNCTION result_type operator()()
+    {
+        ++count_;
+        return engine_();
+    }
+
+    //! Number of draws since construction or the last reset
+    CELER_FUNCTION size_type count() const { return count_; }
+
+    //! Reset the draw count
+    CELER_FUNCTION void reset_count() { count_ = 0; }
+
+    //! Access the wrapped engine
+    CELER_FUNCTION Engine& engine() const { return engine_; }
+
+    //!@{
+    //! Forwarded range of the wrapped engine
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return Engine::min(); }
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return Engine::max(); }
+    //!@}
+
+  private:
+    Engine&   engine_;
+    size_type count_{0};
+
+    template<class G, class R>
+    friend class GenerateCanonical;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a uniform real from the wrapped engine and count one draw.
+ */
+template<class Engine, class RealType>
+class GenerateCanonical<CountingRngEngine<Engine>, RealType>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = RealType;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    //! Sample a random number
+    CELER_FUNCTION result_type operator()(CountingRngEngine<Engine>& rng)
+    {
+        ++rng.count_;
+        return GenerateCanonical<Engine, RealType>()(rng.engine_);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
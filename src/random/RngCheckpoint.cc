@@ -0,0 +1,233 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngCheckpoint.cc
+//---------------------------------------------------------------------------//
+#include "RngCheckpoint.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+#include "base/Assert.hh"
+#include "cuda/RngStateStore.hh"
+#include "philox/PhiloxStateStore.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Generator type stored in a checkpoint
+enum class RngKind : std::uint32_t
+{
+    xorwow = 1,
+    philox = 2
+};
+
+//---------------------------------------------------------------------------//
+// Fixed-size checkpoint header
+struct CheckpointHeader
+{
+    char          magic[8];
+    std::uint32_t version;
+    RngKind       kind;
+    std::uint64_t num_slots;
+    std::uint64_t slot_bytes;
+};
+
+constexpr char          checkpoint_magic[8] = "CELERNG";
+constexpr std::uint32_t checkpoint_version  = 1;
+
+//---------------------------------------------------------------------------//
+// Write trivially copyable values as raw bytes
+template<class T>
+void write_raw(std::ostream& os, const T* data, size_type count)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Checkpoint data must be trivially copyable");
+    os.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    CELER_VALIDATE(os, "Failed to write RNG checkpoint");
+}
+
+//---------------------------------------------------------------------------//
+// Read trivially copyable values as raw bytes
+template<class T>
+void read_raw(std::istream& is, T* data, size_type count)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Checkpoint data must be trivially copyable");
+    is.read(reinterpret_cast<char*>(data), count * sizeof(T));
+    CELER_VALIDATE(is, "Failed to read RNG checkpoint: file is truncated");
+}
+
+//---------------------------------------------------------------------------//
+// Write the checkpoint header
+void write_header(std::ostream& os,
+                  RngKind       kind,
+                  size_type     num_slots,
+                  size_type     slot_bytes)
+{
+    CheckpointHeader header;
+    std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+    header.version    = checkpoint_version;
+    header.kind       = kind;
+    header.num_slots  = num_slots;
+    header.slot_bytes = slot_bytes;
+    write_raw(os, &header, 1);
+}
+
+//---------------------------------------------------------------------------//
+// Read and check the checkpoint header, returning the number of slots
+size_type read_header(std::istream& is, RngKind kind, size_type slot_bytes)
+{
+    CheckpointHeader header;
+    read_raw(is, &header, 1);
+    CELER_VALIDATE(
+        std::memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) == 0,
+        "Stream is not an RNG checkpoint");
+    CELER_VALIDATE(header.version == checkpoint_version,
+                   "Unsupported RNG checkpoint version " << header.version);
+    CELER_VALIDATE(header.kind == kind,
+                   "RNG checkpoint is for a different generator type");
+    CELER_VALIDATE(header.slot_bytes == slot_bytes,
+                   "RNG checkpoint has " << header.slot_bytes
+                                         << " bytes per state but this build "
+                                            "expects "
+                                         << slot_bytes);
+    CELER_VALIDATE(header.num_slots > 0, "RNG checkpoint has no states");
+    return header.num_slots;
+}
+
+//---------------------------------------------------------------------------//
+// Skip to the data of the given slot
+template<class T>
+void seek_slot(std::istream& is, size_type num_slots, ThreadId slot)
+{
+    CELER_VALIDATE(slot && slot.get() < num_slots,
+                   "Slot " << slot.unchecked_get()
+                           << " is out of range for an RNG checkpoint with "
+                           << num_slots << " states");
+    is.seekg(slot.get() * sizeof(T), std::ios::cur);
+    CELER_VALIDATE(is, "Failed to seek in RNG checkpoint");
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save XORWOW generator states.
+ */
+void write_rng_checkpoint(std::ostream& os, const RngStateStore& states)
+{
+    CELER_EXPECT(states.size() > 0);
+    std::vector<RngState> host_states(states.size());
+    states.copy_to_host(make_span(host_states));
+
+    write_header(os, RngKind::xorwow, host_states.size(), sizeof(RngState));
+    write_raw(os, host_states.data(), host_states.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the Philox key and step counters.
+ */
+void write_rng_checkpoint(std::ostream& os, const PhiloxStateStore& states)
+{
+    CELER_EXPECT(states.size() > 0);
+    std::vector<unsigned int> host_steps(states.size());
+    states.copy_to_host(make_span(host_steps));
+
+    write_header(os, RngKind::philox, host_steps.size(), sizeof(unsigned int));
+    write_raw(os, &states.key(), 1);
+    write_raw(os, host_steps.data(), host_steps.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore all XORWOW generator states.
+ *
+ * The store is replaced by one with the size of the checkpoint, in the same
+ * memory space as the original store (host if it was empty).
+ */
+void read_rng_checkpoint(std::istream& is, RngStateStore* states)
+{
+    CELER_EXPECT(states);
+    size_type num_slots = read_header(is, RngKind::xorwow, sizeof(RngState));
+
+    std::vector<RngState> host_states(num_slots);
+    read_raw(is, host_states.data(), host_states.size());
+    *states = RngStateStore(make_span(host_states), states->memspace());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the Philox key and all step counters.
+ *
+ * The store is replaced by one with the size of the checkpoint, in the same
+ * memory space as the original store (host if it was empty).
+ */
+void read_rng_checkpoint(std::istream& is, PhiloxStateStore* states)
+{
+    CELER_EXPECT(states);
+    size_type num_slots
+        = read_header(is, RngKind::philox, sizeof(unsigned int));
+
+    PhiloxKey key;
+    read_raw(is, &key, 1);
+    std::vector<unsigned int> host_steps(num_slots);
+    read_raw(is, host_steps.data(), host_steps.size());
+    *states = PhiloxStateStore(key, make_span(host_steps), states->memspace());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the XORWOW state of a single slot for replay.
+ *
+ * The store is replaced by one with a single state, whose thread zero
+ * reproduces the stream of the given slot.
+ */
+void read_rng_checkpoint(std::istream& is, ThreadId slot, RngStateStore* states)
+{
+    CELER_EXPECT(states);
+    size_type num_slots = read_header(is, RngKind::xorwow, sizeof(RngState));
+    seek_slot<RngState>(is, num_slots, slot);
+
+    RngState state;
+    read_raw(is, &state, 1);
+    *states = RngStateStore(Span<const RngState>{&state, 1},
+                            states->memspace());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the Philox key and step counter of a single slot for replay.
+ *
+ * The store is replaced by one with a single slot. Since the stream of a
+ * Philox track also depends on its event and track IDs, the replayed track
+ * must be constructed with the same IDs as the original.
+ */
+void read_rng_checkpoint(std::istream&     is,
+                         ThreadId          slot,
+                         PhiloxStateStore* states)
+{
+    CELER_EXPECT(states);
+    size_type num_slots
+        = read_header(is, RngKind::philox, sizeof(unsigned int));
+
+    PhiloxKey key;
+    read_raw(is, &key, 1);
+    seek_slot<unsigned int>(is, num_slots, slot);
+    unsigned int step;
+    read_raw(is, &step, 1);
+    *states = PhiloxStateStore(
+        key, Span<const unsigned int>{&step, 1}, states->memspace());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
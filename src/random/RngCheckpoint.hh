@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngCheckpoint.hh
+//! \brief Save and restore random number generator states
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+#include "base/Types.hh"
+
+namespace celeritas
+{
+class RngStateStore;
+class PhiloxStateStore;
+
+//---------------------------------------------------------------------------//
+/*!
+ * \page rng_checkpoint RNG checkpoints
+ *
+ * A checkpoint is a compact binary image of the random number states of all
+ * track slots: a fixed-size header (format version, generator type, number
+ * of slots, and bytes per slot) followed by the raw per-slot data. An XORWOW
+ * checkpoint stores the full generator state of each slot; a Philox
+ * checkpoint stores the key followed by the step counter of each slot.
+ *
+ * Checkpoints are written in the native byte order and state layout, so they
+ * are meant to be read back by the same build on the same architecture.
+ *
+ * Besides restarting a run, a checkpoint can be used to replay a single
+ * misbehaving track: reading one slot produces a single-slot store whose
+ * thread zero generates exactly the draws that the original slot would have.
+ * \code
+    std::ofstream out("rng.bin", std::ios::binary);
+    write_rng_checkpoint(out, states);
+    ...
+    std::ifstream in("rng.bin", std::ios::binary);
+    RngStateStore replay;
+    read_rng_checkpoint(in, ThreadId{1234}, &replay);
+    RngEngine rng(replay.device_pointers(), ThreadId{0});
+   \endcode
+ */
+
+//---------------------------------------------------------------------------//
+// Save XORWOW generator states
+void write_rng_checkpoint(std::ostream& os, const RngStateStore& states);
+
+// Save the Philox key and step counters
+void write_rng_checkpoint(std::ostream& os, const PhiloxStateStore& states);
+
+// Restore all XORWOW generator states
+void read_rng_checkpoint(std::istream& is, RngStateStore* states);
+
+// Restore the Philox key and all step counters
+void read_rng_checkpoint(std::istream& is, PhiloxStateStore* states);
+
+// Restore the XORWOW state of a single slot for replay
+void read_rng_checkpoint(std::istream& is, ThreadId slot, RngStateStore* states);
+
+// Restore the Philox key and step counter of a single slot for replay
+void read_rng_checkpoint(std::istream&     is,
+                         ThreadId          slot,
+                         PhiloxStateStore* states);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -10,8 +10,10 @@
 #include <random>
 #include <vector>
 #include "base/Assert.hh"
+#include "base/Range.hh"
 #include "comm/Device.hh"
 #include "detail/RngStateInit.hh"
+#include "RngEngine.hh"
 
 namespace celeritas
 {
@@ -19,12 +21,23 @@ namespace celeritas
 // METHODS
 //---------------------------------------------------------------------------//
 /*!
- * Construct with the number of RNG states.
+ * Construct with the number of RNG states on device.
  */
 RngStateStore::RngStateStore(size_type size, unsigned long host_seed)
-    : data_(size)
+    : RngStateStore(size, MemSpace::device, host_seed)
 {
-    CELER_EXPECT(celeritas::is_device_enabled());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of RNG states in a given memory space.
+ */
+RngStateStore::RngStateStore(size_type     size,
+                             MemSpace      space,
+                             unsigned long host_seed)
+    : data_(size, space)
+{
+    CELER_EXPECT(space == MemSpace::host || celeritas::is_device_enabled());
     CELER_EXPECT(size > 0);
 
     // Host-side RNG for seeding device RNG
@@ -37,15 +50,41 @@ RngStateStore::RngStateStore(size_type size, unsigned long host_seed)
     for (auto& seed : host_seeds)
         seed = sample_uniform_int(host_rng);
 
-    DeviceVector<seed_type> device_seeds(size);
-    device_seeds.copy_to_device(make_span(host_seeds));
-    detail::rng_state_init_device(this->device_pointers(),
-                                  device_seeds.device_pointers());
+    if (space == MemSpace::host)
+    {
+        // Initialize directly on host
+        RngStatePointers states = this->device_pointers();
+        for (auto i : range(size))
+        {
+            RngEngine rng(states, ThreadId(i));
+            rng = RngSeed{host_seeds[i]};
+        }
+    }
+    else
+    {
+        DeviceVector<seed_type> device_seeds(size);
+        device_seeds.copy_to_device(make_span(host_seeds));
+        detail::rng_state_init_device(this->device_pointers(),
+                                      device_seeds.device_pointers());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from saved states.
+ */
+RngStateStore::RngStateStore(Span<const RngState> states, MemSpace space)
+    : data_(states.size(), space)
+{
+    CELER_EXPECT(space == MemSpace::host || celeritas::is_device_enabled());
+    CELER_EXPECT(!states.empty());
+
+    data_.copy_to_device(states);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Return a view to on-device memory
+ * Return a view to the states in their memory space.
  */
 RngStatePointers RngStateStore::device_pointers()
 {
@@ -57,5 +96,25 @@ RngStatePointers RngStateStore::device_pointers()
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the states to host memory.
+ */
+void RngStateStore::copy_to_host(Span<RngState> host_states) const
+{
+    CELER_EXPECT(host_states.size() == this->size());
+    data_.copy_to_host(host_states);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Overwrite the states with the given host values.
+ */
+void RngStateStore::copy_to_device(Span<const RngState> host_states)
+{
+    CELER_EXPECT(host_states.size() == this->size());
+    data_.copy_to_device(host_states);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
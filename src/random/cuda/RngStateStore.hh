@@ -15,7 +15,13 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Manage ownership of on-device random number generator.
+ * Manage ownership of random number generator states.
+ *
+ * States are on device by default. Host states (which are always available)
+ * produce exactly the same streams as device states with the same seed.
+ *
+ * The states can be copied out and back in (see \c RngCheckpoint.hh) to save
+ * and restore a run, or to replay the stream of a single thread.
  */
 class RngStateStore
 {
@@ -26,14 +32,31 @@ class RngStateStore
     // Construct with the number of RNG states
     explicit RngStateStore(size_type size, unsigned long host_seed = 12345u);
 
+    // Construct with the number of RNG states in a given memory space
+    RngStateStore(size_type     size,
+                  MemSpace      space,
+                  unsigned long host_seed = 12345u);
+
+    // Construct from saved states
+    RngStateStore(Span<const RngState> states, MemSpace space);
+
     //! Number of states
     size_type size() const { return data_.size(); }
 
-    // Access pointers to on-device memory
+    //! Memory space of the states
+    MemSpace memspace() const { return data_.memspace(); }
+
+    // Access pointers to the states
     RngStatePointers device_pointers();
 
+    // Copy the states to host memory
+    void copy_to_host(Span<RngState> host_states) const;
+
+    // Overwrite the states
+    void copy_to_device(Span<const RngState> host_states);
+
   private:
-    // Stored RNG states on device
+    // Stored RNG states
     DeviceVector<RngState> data_;
 };
 
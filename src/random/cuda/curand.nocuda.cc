@@ -7,32 +7,190 @@
 //---------------------------------------------------------------------------//
 #include "curand.nocuda.hh"
 
+#include <vector>
+#include "base/Array.hh"
 #include "base/Assert.hh"
+#include "base/Range.hh"
+#include "base/Types.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+//! Number of 32-bit words in the linear (xorshift) part of the state
+constexpr unsigned int xorwow_words = 5;
+//! Number of bits in the linear part of the state
+constexpr unsigned int xorwow_bits = xorwow_words * 32;
+//! Subsequences are spaced 2^67 draws apart
+constexpr unsigned int subsequence_log2 = 67;
+//! Increment of the Weyl sequence
+constexpr unsigned int weyl_increment = 362437u;
+
+using XorwowVector = Array<unsigned int, xorwow_words>;
+
+//! GF(2) matrix acting on the xorshift state: column i is the image of bit i
+using XorwowMatrix = Array<XorwowVector, xorwow_bits>;
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the xorshift part of the state by a single draw.
+ */
+XorwowVector xorshift(const XorwowVector& v)
+{
+    unsigned int t = v[0] ^ (v[0] >> 2u);
+    return {v[1], v[2], v[3], v[4], (v[4] ^ (v[4] << 4u)) ^ (t ^ (t << 1u))};
+}
+
 //---------------------------------------------------------------------------//
-void curand_init(unsigned long long,
-                 unsigned long long,
-                 unsigned long long,
-                 curandState_t*)
+/*!
+ * Multiply a vector by a GF(2) matrix.
+ */
+XorwowVector multiply(const XorwowMatrix& m, const XorwowVector& v)
 {
-    CELER_ASSERT_UNREACHABLE();
+    XorwowVector result = {0, 0, 0, 0, 0};
+    for (auto i : range(xorwow_bits))
+    {
+        if (v[i / 32] & (1u << (i % 32)))
+        {
+            for (auto w : range(xorwow_words))
+            {
+                result[w] ^= m[i][w];
+            }
+        }
+    }
+    return result;
 }
 
-unsigned int curand(curandState_t*)
+//---------------------------------------------------------------------------//
+/*!
+ * Powers M^(2^k) of the single-draw transition matrix M.
+ *
+ * These allow the state to be advanced by any number of draws (up to the
+ * largest subsequence offset) with one matrix-vector product per set bit. They
+ * are computed once by repeated squaring rather than tabulated.
+ */
+const std::vector<XorwowMatrix>& xorwow_jump_matrices()
 {
-    CELER_ASSERT_UNREACHABLE();
+    static const std::vector<XorwowMatrix> matrices = [] {
+        std::vector<XorwowMatrix> result(subsequence_log2 + 64);
+
+        // Single step: apply the generator to each unit vector
+        for (auto i : range(xorwow_bits))
+        {
+            XorwowVector unit = {0, 0, 0, 0, 0};
+            unit[i / 32]      = 1u << (i % 32);
+            result[0][i]      = xorshift(unit);
+        }
+
+        // Square the previous power
+        for (auto k : range<size_type>(1, result.size()))
+        {
+            const XorwowMatrix& prev = result[k - 1];
+            for (auto i : range(xorwow_bits))
+            {
+                result[k][i] = multiply(prev, prev[i]);
+            }
+        }
+        return result;
+    }();
+    return matrices;
 }
 
-float curand_uniform(curandState_t*)
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the xorshift state by n * 2^(log2_stride) draws.
+ */
+void jump(unsigned long long n, unsigned int log2_stride, curandState_t* state)
 {
-    CELER_ASSERT_UNREACHABLE();
+    const auto& matrices = xorwow_jump_matrices();
+
+    XorwowVector v;
+    for (auto w : range(xorwow_words))
+    {
+        v[w] = state->v[w];
+    }
+    for (unsigned int k = 0; n != 0; ++k, n >>= 1)
+    {
+        if (n & 1u)
+        {
+            CELER_ASSERT(log2_stride + k < matrices.size());
+            v = multiply(matrices[log2_stride + k], v);
+        }
+    }
+    for (auto w : range(xorwow_words))
+    {
+        state->v[w] = v[w];
+    }
 }
 
-double curand_uniform_double(curandState_t*)
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the state from a seed, subsequence, and offset.
+ *
+ * The seed is salted and mixed into the initial state exactly as by cuRAND's
+ * \c curand_init; the state is then advanced by \c subsequence * 2^67 + \c
+ * offset draws.
+ */
+void curand_init(unsigned long long seed,
+                 unsigned long long subsequence,
+                 unsigned long long offset,
+                 curandState_t*     state)
+{
+    CELER_EXPECT(state);
+
+    // Break up seed and apply salt
+    unsigned int s0 = static_cast<unsigned int>(seed) ^ 0xaad26b49u;
+    unsigned int s1 = static_cast<unsigned int>(seed >> 32) ^ 0xf7dcefddu;
+    // Mix up bits with multiplication by odd constants
+    unsigned int t0 = 1099087573u * s0;
+    unsigned int t1 = 2591861531u * s1;
+
+    state->d    = 6615241u + t1 + t0;
+    state->v[0] = 123456789u + t0;
+    state->v[1] = 362436069u ^ t0;
+    state->v[2] = 521288629u + t1;
+    state->v[3] = 88675123u ^ t1;
+    state->v[4] = 5783321u + t0;
+
+    skipahead_sequence(subsequence, state);
+    skipahead(offset, state);
+
+    state->boxmuller_flag         = 0;
+    state->boxmuller_flag_double  = 0;
+    state->boxmuller_extra        = 0.f;
+    state->boxmuller_extra_double = 0.;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the state by n draws.
+ */
+void skipahead(unsigned long long n, curandState_t* state)
+{
+    CELER_EXPECT(state);
+    jump(n, 0, state);
+    state->d += weyl_increment * static_cast<unsigned int>(n);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the state by n subsequences of 2^67 draws.
+ *
+ * As in cuRAND, the Weyl sequence is not advanced (2^67 increments are a
+ * multiple of 2^32 and leave it unchanged anyway).
+ */
+void skipahead_sequence(unsigned long long n, curandState_t* state)
 {
-    CELER_ASSERT_UNREACHABLE();
+    CELER_EXPECT(state);
+    jump(n, subsequence_log2, state);
 }
 
 //---------------------------------------------------------------------------//
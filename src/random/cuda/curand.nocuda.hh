@@ -4,7 +4,7 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT)
 //---------------------------------------------------------------------------//
 //! \file curand.nocuda.hh
-//! \brief Support compiling/linking but raise runtime errors.
+//! \brief Host implementation of the cuRAND default (XORWOW) generator.
 //---------------------------------------------------------------------------//
 #pragma once
 
@@ -16,24 +16,42 @@
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
-//! Placeholder for CUDA random state to allow compiling
-struct MockCurandState
+/*!
+ * State of an XORWOW generator, laid out like \c curandStateXORWOW.
+ *
+ * The generator (Marsaglia's xorshift combined with a Weyl sequence) and its
+ * initialization are reproduced bit for bit, so a given seed, subsequence, and
+ * offset yield the same stream on host as cuRAND does on device. The Box-Muller
+ * caches are unused but kept for layout compatibility.
+ */
+struct XorwowState
 {
+    unsigned int d;
+    unsigned int v[5];
+    int          boxmuller_flag;
+    int          boxmuller_flag_double;
+    float        boxmuller_extra;
+    double       boxmuller_extra_double;
 };
 
-using curandState_t = MockCurandState;
+using curandStateXORWOW_t = XorwowState;
+using curandState_t       = XorwowState;
 
 //---------------------------------------------------------------------------//
 //!@{
 //! CUDA random functions.
-void         curand_init(unsigned long long seed,
-                         unsigned long long sequence,
-                         unsigned long long offset,
-                         curandState_t*     state);
-unsigned int curand(curandState_t* state);
-float        curand_uniform(curandState_t* state);
-double       curand_uniform_double(curandState_t* state);
+void curand_init(unsigned long long seed,
+                 unsigned long long subsequence,
+                 unsigned long long offset,
+                 curandState_t*     state);
+void skipahead(unsigned long long n, curandState_t* state);
+void skipahead_sequence(unsigned long long n, curandState_t* state);
+inline unsigned int curand(curandState_t* state);
+inline float        curand_uniform(curandState_t* state);
+inline double       curand_uniform_double(curandState_t* state);
 //!@}
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas
+
+#include "curand.nocuda.i.hh"
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file curand.nocuda.i.hh
+//---------------------------------------------------------------------------//
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Return 32 random bits and advance the state.
+ */
+unsigned int curand(curandState_t* state)
+{
+    unsigned int* v = state->v;
+    unsigned int  t = v[0] ^ (v[0] >> 2u);
+    v[0]            = v[1];
+    v[1]            = v[2];
+    v[2]            = v[3];
+    v[3]            = v[4];
+    v[4]            = (v[4] ^ (v[4] << 4u)) ^ (t ^ (t << 1u));
+    state->d += 362437u;
+    return v[4] + state->d;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a float uniformly on (0, 1].
+ */
+float curand_uniform(curandState_t* state)
+{
+    constexpr float two_pow_m32 = 2.3283064e-10f;
+    return static_cast<float>(curand(state)) * two_pow_m32
+           + two_pow_m32 / 2.0f;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a double uniformly on (0, 1] using 53 bits from two draws.
+ */
+double curand_uniform_double(curandState_t* state)
+{
+    constexpr double two_pow_m53 = 1.1102230246251565e-16;
+
+    unsigned long long x = curand(state);
+    unsigned long long y = curand(state);
+    unsigned long long z = x ^ (y << (53u - 32u));
+    return static_cast<double>(z) * two_pow_m53 + two_pow_m53 / 2.0;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
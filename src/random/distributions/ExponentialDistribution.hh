@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <type_traits>
 #include "base/Macros.hh"
+#include "SamplingMethod.hh"
 
 namespace celeritas
 {
@@ -23,8 +25,12 @@ namespace celeritas
  * constructed locally with the default value of lambda = 1.0, the
  * inversion and multiplication will be optimized out (and the code will be
  * exactly identical to `-std::log(rng.ran())`.
+ *
+ * With \c SamplingMethod::ziggurat the logarithm is replaced by a table
+ * lookup for almost every sample, at the cost of a varying number of draws
+ * per sample.
  */
-template<class RealType = double>
+template<class RealType = double, SamplingMethod M = SamplingMethod::direct>
 class ExponentialDistribution
 {
   public:
@@ -44,7 +50,17 @@ class ExponentialDistribution
     inline CELER_FUNCTION result_type operator()(Generator& g);
 
   private:
+    template<SamplingMethod N>
+    using MethodTag = std::integral_constant<SamplingMethod, N>;
+
     result_type neg_inv_lambda_;
+
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::direct>);
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::ziggurat>);
 };
 
 //---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 #include <cmath>
 #include "base/Assert.hh"
 #include "GenerateCanonical.hh"
+#include "detail/Ziggurat.hh"
 
 namespace celeritas
 {
@@ -15,9 +16,9 @@ namespace celeritas
 /*!
  * Construct from the mean of the exponential distribution.
  */
-template<class RT>
+template<class RT, SamplingMethod M>
 CELER_FUNCTION
-ExponentialDistribution<RT>::ExponentialDistribution(real_type lambda)
+ExponentialDistribution<RT, M>::ExponentialDistribution(real_type lambda)
     : neg_inv_lambda_(real_type{-1} / lambda)
 {
     CELER_EXPECT(lambda > real_type{0});
@@ -27,13 +28,42 @@ ExponentialDistribution<RT>::ExponentialDistribution(real_type lambda)
 /*!
  * Sample a random number according to the distribution.
  */
-template<class RT>
+template<class RT, SamplingMethod M>
 template<class Generator>
-CELER_FUNCTION auto ExponentialDistribution<RT>::operator()(Generator& rng)
+CELER_FUNCTION auto ExponentialDistribution<RT, M>::operator()(Generator& rng)
+    -> result_type
+{
+    return this->sample(rng, MethodTag<M>{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample by inversion.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+ExponentialDistribution<RT, M>::sample(Generator& rng,
+                                       MethodTag<SamplingMethod::direct>)
     -> result_type
 {
     return std::log(generate_canonical<RT>(rng)) * neg_inv_lambda_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sample with the Ziggurat method.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+ExponentialDistribution<RT, M>::sample(Generator& rng,
+                                       MethodTag<SamplingMethod::ziggurat>)
+    -> result_type
+{
+    return static_cast<RT>(detail::sample_ziggurat_exponential(rng))
+           * -neg_inv_lambda_;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,17 +7,25 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "UniformRealDistribution.hh"
+#include <type_traits>
 #include "base/Array.hh"
 #include "base/Types.hh"
+#include "SamplingMethod.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Sample points uniformly on the surface of a unit sphere.
+ *
+ * The direct method samples the polar cosine and the azimuthal angle
+ * independently, consuming exactly two draws and evaluating a sine and cosine.
+ * The rejection method is Marsaglia's: a point \f$ (u, v) \f$ sampled
+ * uniformly in the unit disk with \f$ s = u^2 + v^2 \f$ maps to
+ * \f$ (2u\sqrt{1-s}, 2v\sqrt{1-s}, 1 - 2s) \f$, which needs one square root
+ * and an average of \f$ 8/\pi \f$ draws.
  */
-template<class RealType = double>
+template<class RealType = double, SamplingMethod M = SamplingMethod::direct>
 class IsotropicDistribution
 {
   public:
@@ -36,8 +44,15 @@ class IsotropicDistribution
     inline CELER_FUNCTION result_type operator()(Generator& rng);
 
   private:
-    UniformRealDistribution<real_type> sample_costheta_;
-    UniformRealDistribution<real_type> sample_phi_;
+    template<SamplingMethod N>
+    using MethodTag = std::integral_constant<SamplingMethod, N>;
+
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::direct>);
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::rejection>);
 };
 
 //---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 
 #include <cmath>
 #include "base/Constants.hh"
+#include "GenerateCanonical.hh"
 
 namespace celeritas
 {
@@ -15,9 +16,8 @@ namespace celeritas
 /*!
  * Construct with defaults.
  */
-template<class RealType>
-CELER_FUNCTION IsotropicDistribution<RealType>::IsotropicDistribution()
-    : sample_costheta_(-1, 1), sample_phi_(0, 2 * constants::pi)
+template<class RT, SamplingMethod M>
+CELER_FUNCTION IsotropicDistribution<RT, M>::IsotropicDistribution()
 {
 }
 
@@ -25,16 +25,55 @@ CELER_FUNCTION IsotropicDistribution<RealType>::IsotropicDistribution()
 /*!
  * Sample an isotropic unit vector.
  */
-template<class RealType>
+template<class RT, SamplingMethod M>
 template<class Generator>
-CELER_FUNCTION auto IsotropicDistribution<RealType>::operator()(Generator& rng)
+CELER_FUNCTION auto IsotropicDistribution<RT, M>::operator()(Generator& rng)
     -> result_type
 {
-    const real_type costheta = sample_costheta_(rng);
-    const real_type phi      = sample_phi_(rng);
+    return this->sample(rng, MethodTag<M>{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the polar cosine and azimuthal angle independently.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+IsotropicDistribution<RT, M>::sample(Generator& rng,
+                                     MethodTag<SamplingMethod::direct>)
+    -> result_type
+{
+    const real_type costheta = 2 * generate_canonical<RT>(rng) - 1;
+    const real_type phi = 2 * constants::pi * generate_canonical<RT>(rng);
     const real_type sintheta = std::sqrt(1 - costheta * costheta);
     return {sintheta * std::cos(phi), sintheta * std::sin(phi), costheta};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a point in the unit disk and project it onto the sphere.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+IsotropicDistribution<RT, M>::sample(Generator& rng,
+                                     MethodTag<SamplingMethod::rejection>)
+    -> result_type
+{
+    real_type u;
+    real_type v;
+    real_type rsq;
+    do
+    {
+        u   = 2 * generate_canonical<RT>(rng) - 1;
+        v   = 2 * generate_canonical<RT>(rng) - 1;
+        rsq = u * u + v * v;
+    } while (rsq > 1);
+
+    const real_type scale = 2 * std::sqrt(1 - rsq);
+    return {u * scale, v * scale, 1 - 2 * rsq};
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
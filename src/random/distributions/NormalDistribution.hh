@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NormalDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <type_traits>
+#include "base/Macros.hh"
+#include "SamplingMethod.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample from a normal (Gaussian) distribution.
+ *
+ * The direct method is the Box-Muller transform, which produces two
+ * independent samples from two uniform draws; the second sample is saved and
+ * returned by the next call. The Ziggurat method needs no saved state and
+ * avoids transcendental functions for almost every sample.
+ */
+template<class RealType = double, SamplingMethod M = SamplingMethod::direct>
+class NormalDistribution
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = RealType;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Construct with mean and standard deviation
+    explicit inline CELER_FUNCTION
+    NormalDistribution(real_type mean = 0, real_type stddev = 1);
+
+    // Sample a random number according to the distribution
+    template<class Generator>
+    inline CELER_FUNCTION result_type operator()(Generator& rng);
+
+    //// ACCESSORS ////
+
+    //! Get the mean of the distribution
+    CELER_FUNCTION real_type mean() const { return mean_; }
+
+    //! Get the standard deviation of the distribution
+    CELER_FUNCTION real_type stddev() const { return stddev_; }
+
+  private:
+    template<SamplingMethod N>
+    using MethodTag = std::integral_constant<SamplingMethod, N>;
+
+    real_type mean_;
+    real_type stddev_;
+    real_type spare_{0};
+    bool      has_spare_{false};
+
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::direct>);
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::ziggurat>);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "NormalDistribution.i.hh"
@@ -0,0 +1,80 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NormalDistribution.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "GenerateCanonical.hh"
+#include "detail/Ziggurat.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with mean and standard deviation.
+ */
+template<class RT, SamplingMethod M>
+CELER_FUNCTION
+NormalDistribution<RT, M>::NormalDistribution(real_type mean, real_type stddev)
+    : mean_(mean), stddev_(stddev)
+{
+    CELER_EXPECT(stddev > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random number according to the distribution.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto NormalDistribution<RT, M>::operator()(Generator& rng)
+    -> result_type
+{
+    return mean_ + stddev_ * this->sample(rng, MethodTag<M>{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the standard normal distribution with the Box-Muller transform.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+NormalDistribution<RT, M>::sample(Generator& rng,
+                                  MethodTag<SamplingMethod::direct>)
+    -> result_type
+{
+    if (has_spare_)
+    {
+        has_spare_ = false;
+        return spare_;
+    }
+
+    real_type radius = std::sqrt(real_type(-2)
+                                 * std::log(generate_canonical<RT>(rng)));
+    real_type theta = 2 * real_type(constants::pi) * generate_canonical<RT>(rng);
+    spare_          = radius * std::sin(theta);
+    has_spare_      = true;
+    return radius * std::cos(theta);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the standard normal distribution with the Ziggurat method.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+NormalDistribution<RT, M>::sample(Generator& rng,
+                                  MethodTag<SamplingMethod::ziggurat>)
+    -> result_type
+{
+    return static_cast<RT>(detail::sample_ziggurat_normal(rng));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SamplingMethod.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Algorithm used by a distribution to transform uniform random numbers.
+ *
+ * - \c direct uses an analytic transformation (e.g. inversion), which is
+ *   exact and consumes a fixed number of draws but evaluates transcendental
+ *   functions for every sample.
+ * - \c ziggurat uses the Ziggurat rejection method with precomputed layer
+ *   tables: most samples need one draw, a table lookup, and a multiply.
+ * - \c rejection samples a point uniformly inside a simple bounding region
+ *   (e.g. Marsaglia's method of sampling in the unit disk) and transforms it
+ *   with arithmetic only, at the cost of a variable number of draws.
+ */
+enum class SamplingMethod
+{
+    direct,
+    ziggurat,
+    rejection
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UniformAzimuthDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <type_traits>
+#include "base/Array.hh"
+#include "base/Macros.hh"
+#include "SamplingMethod.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the cosine and sine of an azimuthal angle uniform in [0, 2pi).
+ *
+ * Scattering calculations only ever need the azimuthal angle \em phi through
+ * its cosine and sine, so this distribution returns the pair \c {cos(phi),
+ * sin(phi)} directly. The direct method samples \em phi and evaluates both
+ * trigonometric functions. The rejection method samples a point uniformly in
+ * the unit disk and uses the double-angle formulas
+ * \f[
+   \cos\phi = \frac{u^2 - v^2}{u^2 + v^2}, \quad
+   \sin\phi = \frac{2uv}{u^2 + v^2} ,
+ * \f]
+ * which accepts a pair of draws with probability \f$ \pi/4 \f$ and needs no
+ * transcendental functions.
+ *
+ * \code
+    UniformAzimuthDistribution<real_type, SamplingMethod::rejection> sample_phi;
+    Real3 dir = rotate(costheta, sample_phi(rng), inc_direction);
+   \endcode
+ */
+template<class RealType = double, SamplingMethod M = SamplingMethod::direct>
+class UniformAzimuthDistribution
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = RealType;
+    using result_type = Array<real_type, 2>;
+    //!@}
+
+  public:
+    // Sample the cosine and sine of a random azimuthal angle
+    template<class Generator>
+    inline CELER_FUNCTION result_type operator()(Generator& rng);
+
+  private:
+    template<SamplingMethod N>
+    using MethodTag = std::integral_constant<SamplingMethod, N>;
+
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::direct>);
+    template<class Generator>
+    inline CELER_FUNCTION result_type
+    sample(Generator& rng, MethodTag<SamplingMethod::rejection>);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "UniformAzimuthDistribution.i.hh"
@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UniformAzimuthDistribution.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Constants.hh"
+#include "GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the cosine and sine of a random azimuthal angle.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto UniformAzimuthDistribution<RT, M>::operator()(Generator& rng)
+    -> result_type
+{
+    return this->sample(rng, MethodTag<M>{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the angle and evaluate its cosine and sine.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+UniformAzimuthDistribution<RT, M>::sample(Generator& rng,
+                                          MethodTag<SamplingMethod::direct>)
+    -> result_type
+{
+    const real_type phi = 2 * real_type(constants::pi)
+                          * generate_canonical<RT>(rng);
+    return {std::cos(phi), std::sin(phi)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a point in the unit disk and apply the double-angle formulas.
+ *
+ * The origin is rejected along with points outside the disk so that the
+ * normalization is always finite.
+ */
+template<class RT, SamplingMethod M>
+template<class Generator>
+CELER_FUNCTION auto
+UniformAzimuthDistribution<RT, M>::sample(Generator& rng,
+                                          MethodTag<SamplingMethod::rejection>)
+    -> result_type
+{
+    real_type u;
+    real_type v;
+    real_type rsq;
+    do
+    {
+        u   = 2 * generate_canonical<RT>(rng) - 1;
+        v   = 2 * generate_canonical<RT>(rng) - 1;
+        rsq = u * u + v * v;
+    } while (rsq > 1 || rsq == 0);
+
+    const real_type inv_rsq = 1 / rsq;
+    return {(u * u - v * v) * inv_rsq, 2 * u * v * inv_rsq};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Ziggurat.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include "base/Macros.hh"
+#include "../GenerateCanonical.hh"
+#include "ZigguratTables.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Choose a Ziggurat layer and a uniform position within it from one draw.
+ *
+ * The leading eight bits of a canonical double select one of the 256 layers,
+ * and the remaining 45 bits give the fractional position.
+ */
+struct ZigguratPoint
+{
+    int    layer;
+    double frac;
+};
+
+template<class Generator>
+CELER_FORCEINLINE_FUNCTION ZigguratPoint sample_ziggurat_point(Generator& rng)
+{
+    double u     = generate_canonical<double>(rng) * 256;
+    int    layer = static_cast<int>(u);
+    if (CELER_UNLIKELY(layer == 256))
+    {
+        // Generators that sample on (0, 1] can return exactly 1
+        layer = 255;
+    }
+    return {layer, u - layer};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the standard exponential distribution with the Ziggurat method.
+ *
+ * About 98.9% of samples are accepted from the interior of a layer without
+ * evaluating any transcendental function.
+ */
+template<class Generator>
+CELER_FUNCTION double sample_ziggurat_exponential(Generator& rng)
+{
+    const double* x = ziggurat_exponential_x;
+    while (true)
+    {
+        auto   pt     = sample_ziggurat_point(rng);
+        double result = pt.frac * x[pt.layer];
+        if (result < x[pt.layer + 1])
+        {
+            // Inside the rectangle: entirely under the density
+            return result;
+        }
+        if (pt.layer == 0)
+        {
+            // Exponential tail beyond r is a shifted exponential
+            return x[1] - std::log(generate_canonical<double>(rng));
+        }
+        // Wedge between the rectangle and the density
+        double f_lo = std::exp(-x[pt.layer]);
+        double f_hi = std::exp(-x[pt.layer + 1]);
+        if (f_lo + (f_hi - f_lo) * generate_canonical<double>(rng)
+            < std::exp(-result))
+        {
+            return result;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the standard normal distribution with the Ziggurat method.
+ *
+ * About 99.3% of samples are accepted from the interior of a layer. The tail
+ * beyond r is sampled with Marsaglia's method.
+ */
+template<class Generator>
+CELER_FUNCTION double sample_ziggurat_normal(Generator& rng)
+{
+    const double* x = ziggurat_normal_x;
+    while (true)
+    {
+        auto   pt     = sample_ziggurat_point(rng);
+        double result = (2 * pt.frac - 1) * x[pt.layer];
+        double abs_result = std::fabs(result);
+        if (abs_result < x[pt.layer + 1])
+        {
+            // Inside the rectangle: entirely under the density
+            return result;
+        }
+        if (pt.layer == 0)
+        {
+            // Gaussian tail beyond r
+            const double r = x[1];
+            double       a, b;
+            do
+            {
+                a = -std::log(generate_canonical<double>(rng)) / r;
+                b = -std::log(generate_canonical<double>(rng));
+            } while (2 * b < a * a);
+            return result < 0 ? -(r + a) : r + a;
+        }
+        // Wedge between the rectangle and the density
+        double f_lo = std::exp(-x[pt.layer] * x[pt.layer] / 2);
+        double f_hi = std::exp(-x[pt.layer + 1] * x[pt.layer + 1] / 2);
+        if (f_lo + (f_hi - f_lo) * generate_canonical<double>(rng)
+            < std::exp(-abs_result * abs_result / 2))
+        {
+            return result;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,226 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ZigguratTables.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+
+/*!
+ * \def CELER_ZIGGURAT_TABLE
+ *
+ * Storage of the Ziggurat layer tables: constant memory on device, and
+ * compile-time constants on host. Each translation unit has its own copy.
+ */
+#ifdef __CUDA_ARCH__
+#    define CELER_ZIGGURAT_TABLE static __constant__ const
+#else
+#    define CELER_ZIGGURAT_TABLE static constexpr
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//!@{
+/*!
+ * Layer edges for 256-layer Ziggurats (Marsaglia and Tsang, J. Stat. Softw.
+ * 5(8), 2000).
+ *
+ * For an unnormalized density f, the tail starts at r = x[1], every layer
+ * (including the base layer plus tail) has area v, and
+ * \verbatim
+   x[0] = v / f(r)
+   x[i + 1] = f^{-1}(f(x[i]) + v / x[i])
+   x[256] = 0
+   \endverbatim
+ * The tables were generated in double precision from
+ * f(x) = exp(-x), r = 7.69711747013104972, v = 3.9496598225815572e-3 and
+ * f(x) = exp(-x^2 / 2), r = 3.6541528853610088, v = 4.92867323399e-3.
+ */
+CELER_ZIGGURAT_TABLE double ziggurat_exponential_x[257] = {
+    8.6971174701310527, 7.6971174701310501, 6.9410336293772126,
+    6.4783784938325697, 6.1441646657724727, 5.8821443157953999,
+    5.6664101674540337, 5.4828906275260625, 5.323090505754398,
+    5.1814872813015, 5.0542884899813041, 4.9387770859012505,
+    4.832939741025112, 4.7352429966017411, 4.6444918854200852,
+    4.5597370617073514, 4.4802117465284219, 4.4052876934735732,
+    4.334443680317273, 4.2672424802773659, 4.2033137137351844,
+    4.1423408656640515, 4.0840513104082978, 4.0282085446479368,
+    3.9746060666737888, 3.9230625001354897, 3.8734176703995091,
+    3.8255294185223367, 3.7792709924116679, 3.7345288940397974,
+    3.6912010902374188, 3.6491955157608538, 3.6084288131289095,
+    3.568825265648337, 3.5303158891293434, 3.4928376547740596,
+    3.4563328211327602, 3.4207483572511199, 3.386035442460301,
+    3.3521490309001094, 3.319047470970748, 3.2866921715990687,
+    3.2550473085704499, 3.2240795652862642, 3.1937579032122403,
+    3.1640533580259729, 3.1349388580844404, 3.1063890623398245,
+    3.0783802152540902, 3.0508900166154551, 3.0238975044556766,
+    2.9973829495161306, 2.9713277599210897, 2.9457143948950457,
+    2.9205262865127408, 2.8957477686001418, 2.8713640120155364,
+    2.8473609656351888, 2.8237253024500353, 2.8004443702507378,
+    2.7775061464397566, 2.7548991965623446, 2.7326126361947001,
+    2.7106360958679288, 2.6889596887418037, 2.6675739807732666,
+    2.6464699631518092, 2.6256390267977885, 2.6050729387408356,
+    2.5847638202141408, 2.5647041263169053, 2.54488662711187,
+    2.525304390037828, 2.505950763528594, 2.4868193617402095,
+    2.4679040502973648, 2.4491989329782498, 2.4306983392644197,
+    2.4123968126888706, 2.3942890999214579, 2.3763701405361406,
+    2.3586350574093373, 2.3410791477030344, 2.3236978743901964,
+    2.3064868582835798, 2.2894418705322694, 2.2725588255531548,
+    2.2558337743672192, 2.239262898312909, 2.2228425031110368,
+    2.2065690132576639, 2.19043896672322, 2.1744490099377747,
+    2.158595893043886, 2.142876465399842, 2.1272876713173683,
+    2.1118265460190422, 2.096490211801715, 2.0812758743932251,
+    2.0661808194905755, 2.0512024094685848, 2.0363380802487696,
+    2.0215853383189262, 2.0069417578945186, 1.9924049782135766,
+    1.9779727009573604, 1.9636426877895483, 1.9494127580071849,
+    1.9352807862970514, 1.9212447005915281, 1.9073024800183875,
+    1.8934521529393082, 1.8796917950722112, 1.866019527692828,
+    1.8524335159111756, 1.83893196701888, 1.8255131289035198,
+    1.8121752885263906, 1.7989167704602909, 1.785735935484126,
+    1.7726311792313056, 1.7596009308890748, 1.7466436519460744,
+    1.7337578349855716, 1.7209420025219353, 1.7081947058780578,
+    1.6955145241015379, 1.6829000629175539, 1.6703499537164521,
+    1.6578628525741728, 1.6454374393037237, 1.6330724165359913,
+    1.6207665088282579, 1.6085184617988584, 1.5963270412864834,
+    1.5841910325326889, 1.5721092393862297, 1.5600804835278881,
+    1.5481036037145135, 1.5361774550410321, 1.5243009082192263,
+    1.5124728488721171, 1.5006921768428167, 1.4889578055167461,
+    1.4772686611561339, 1.4656236822457454, 1.4540218188487934,
+    1.4424620319720125, 1.4309432929388797, 1.4194645827699832,
+    1.4080248915695357, 1.3966232179170421, 1.385258568263122,
+    1.3739299563284906, 1.3626364025050868, 1.3513769332583352,
+    1.3401505805295046, 1.3289563811371166, 1.3177933761763247,
+    1.3066606104151741, 1.295557131686601, 1.2844819902750126,
+    1.2734342382962411, 1.2624129290696153, 1.2514171164808525,
+    1.2404458543344066, 1.2294981956938491, 1.2185731922087901,
+    1.2076698934267611, 1.1967873460884031, 1.1859245934042022,
+    1.1750806743109117, 1.1642546227056789, 1.1534454666557747,
+    1.1426522275816728, 1.1318739194110785, 1.1211095477013302,
+    1.110358108727411, 1.0996185885325973, 1.0888899619385468,
+    1.0781711915113723, 1.0674612264799677, 1.0567590016025514,
+    1.0460634359770442, 1.0353734317905285, 1.0246878730026172,
+    1.0140056239570965, 1.0033255279156967, 0.9926464055072759,
+    0.9819670530850626, 0.97128624098390326, 0.96060271166866651,
+    0.94991517776407597, 0.93922231995526229, 0.92852278474721039,
+    0.91781518207004431, 0.90709808271569026, 0.89637001558988993,
+    0.88562946476175153, 0.87487486629102507, 0.86410460481100448,
+    0.85331700984237335, 0.84251035181036849, 0.83168283773427321,
+    0.82083260655441181, 0.80995772405741828, 0.79905617735548717,
+    0.78812586886949243, 0.77716460975912971, 0.76617011273543467,
+    0.75513998418198225, 0.7440717155005081, 0.7329626735843654,
+    0.7218100903087562, 0.71061105090965504, 0.69936248110323196,
+    0.68806113277374781, 0.67670356802952258, 0.66528614139267794,
+    0.65380497984766495, 0.64225596042453637, 0.63063468493349029,
+    0.61893645139487607, 0.60715622162030003, 0.59528858429150289,
+    0.58332771274876949, 0.57126731653258833, 0.55910058551154063,
+    0.54682012516331058, 0.5344178812371656, 0.52188505159213505,
+    0.5092119824436544, 0.49638804551867116, 0.48340149165346186,
+    0.47023927508216901, 0.45688684093142024, 0.4433278660735524,
+    0.4295439402254107, 0.41551416960035636, 0.40121467889627777,
+    0.38661797794111957, 0.37169214532991723, 0.35639976025839382,
+    0.34069648106484912, 0.32452911701690945, 0.30783295467493216,
+    0.29052795549123039, 0.2725131854784647, 0.25365836338591202,
+    0.23379048305967473, 0.21267151063096662, 0.18995868962243184,
+    0.16512762256418728, 0.13730498094001259, 0.10483850756581878,
+    0.06385216381500157, 0
+};
+
+CELER_ZIGGURAT_TABLE double ziggurat_normal_x[257] = {
+    3.91075795953709, 3.6541528853610088, 3.4492782985609645,
+    3.3202447338391661, 3.2245750520470291, 3.14788928951715,
+    3.083526132001233, 3.0278377917686354, 2.9786032798808448,
+    2.9343668672078542, 2.8941210536123481, 2.8571387308721325,
+    2.8228773968253251, 2.7909211740007858, 2.7609440052788226,
+    2.7326853590428271, 2.7059336561218581, 2.6805146432845222,
+    2.6562830375755024, 2.6331163936303246, 2.6109105184875485,
+    2.5895759867069952, 2.5690354526805366, 2.5492215503234608,
+    2.5300752321585169, 2.5115444416253423, 2.4935830412696807,
+    2.4761499396691433, 2.4592083743333113, 2.4427253181989568,
+    2.426670984935726, 2.4110184138996855, 2.3957431197804806,
+    2.380822795170626, 2.3662370567158186, 2.35196722737766,
+    2.3379961487950314, 2.324308018869623, 2.31088825059985,
+    2.2977233489013296, 2.2848008027229461, 2.2721089902268239,
+    2.2596370951722178, 2.2473750329458078, 2.235313384928328,
+    2.2234433400909057, 2.2117566428825444, 2.200245546609648,
+    2.1889027716247207, 2.1777214677386416, 2.166695180352646,
+    2.1558178198750633, 2.1450836340462036, 2.1344871828443202,
+    2.1240233156878157, 2.113687150684934, 2.1034740557131468,
+    2.0933796311370503, 2.0833996939965518, 2.0735302635169788,
+    2.0637675478099564, 2.0541079316488648, 2.0445479652157328,
+    2.0350843537278087, 2.025713947862033, 2.0164337349043717,
+    2.0072408305586849, 1.9981324713565642, 1.9891060076155713,
+    1.9801588968985984, 1.9712886979317696, 1.9624930649424619,
+    1.953769742382734, 1.9451165600067539, 1.9365314282737589,
+    1.9280123340507183, 1.9195573365912288, 1.9111645637692822,
+    1.9028322085484464, 1.8945585256687101, 1.8863418285347764,
+    1.8781804862909777, 1.8700729210692368, 1.8620176053976323,
+    1.8540130597581481, 1.8460578502831198, 1.8381505865807286,
+    1.8302899196806666, 1.8224745400917832, 1.8147031759641676,
+    1.8069745913486934, 1.7992875845475802, 1.79164098655001,
+    1.7840336595472763, 1.776464495522345, 1.7689324149090779,
+    1.7614363653167067, 1.7539753203154551, 1.746548278279493,
+    1.739154261283669, 1.7317923140507072, 1.7244615029457757,
+    1.7171609150155407, 1.7098896570690061, 1.7026468547976139,
+    1.6954316519322385, 1.6882432094348587, 1.6810807047228233,
+    1.6739433309237604, 1.6668302961592867, 1.6597408228557895,
+    1.6526741470806485, 1.6456295179023603, 1.6386061967731111,
+    1.631603456932422, 1.6246205828305684, 1.6176568695705342,
+    1.6107116223673337, 1.603784156023583, 1.5968737944202613,
+    1.5899798700216485, 1.5831017233934714, 1.5762387027333329,
+    1.5693901634125345, 1.5625554675284397, 1.5557339834665549,
+    1.5489250854715355, 1.5421281532263476, 1.5353425714388431,
+    1.5285677294350246, 1.5218030207582931, 1.5150478427739924,
+    1.508301596278572, 1.5015636851127065, 1.4948335157777184,
+    1.4881104970546544, 1.4813940396253757, 1.4746835556950255,
+    1.4679784586152309, 1.4612781625074078, 1.4545820818855233,
+    1.4478896312776697, 1.441200224845798, 1.4345132760029464,
+    1.4278281970272904, 1.4211443986723231, 1.4144612897724647,
+    1.4077782768433715, 1.4010947636762026, 1.3944101509250713,
+    1.3877238356868846, 1.381035211072742, 1.3743436657700305,
+    1.367648583594318, 1.3609493430301018, 1.3542453167594306,
+    1.3475358711773593, 1.3408203658931521, 1.3340981532160836,
+    1.3273685776246247, 1.3206309752177301, 1.313884673146869,
+    1.3071289890273539, 1.3003632303274337, 1.2935866937335176,
+    1.2867986644897864, 1.2799984157103332, 1.2731852076618437,
+    1.2663582870146883, 1.2595168860601442, 1.2526602218912979,
+    1.2457874955449979, 1.2388978911020274, 1.2319905747424451,
+    1.225064693752808, 1.2181193754817266, 1.2111537262399112,
+    1.2041668301405601, 1.1971577478755859, 1.1901255154228016,
+    1.1830691426787607, 1.1759876120114898, 1.1688798767268338,
+    1.1617448594415742, 1.1545814503558518, 1.1473885054167339,
+    1.1401648443639958, 1.132909248648337, 1.1256204592112944,
+    1.1182971741150629, 1.1109380460092495, 1.1035416794202682,
+    1.0961066278476035, 1.0886313906495142, 1.0811144096988894,
+    1.0735540657878717, 1.0659486747575067, 1.0582964833260065,
+    1.0505956645862071, 1.0428443131393705, 1.0350404398286053,
+    1.0271819660307513, 1.0192667174605292, 1.0112924174349784,
+    1.0032566795395914, 0.99515699962994308, 0.98699074709384627,
+    0.97875515528893775, 0.97044731105886461, 0.96206414321760525,
+    0.95360240987557265, 0.94505868446257113, 0.93642934028089686,
+    0.92771053339623477, 0.91889818364373499, 0.909987953490769,
+    0.90097522445517453, 0.89185507072679238, 0.88262222957891012,
+    0.87327106808249455, 0.86379554554682692, 0.85418917100156055,
+    0.84444495490242366, 0.83455535407951875, 0.82451220874528863,
+    0.81430667012806435, 0.80392911698266489, 0.79336905883315278,
+    0.78261502329958876, 0.77165442421673935, 0.76047340642208316,
+    0.74905666200958165, 0.73738721142583863, 0.72544614090130355,
+    0.71321228518202273, 0.70066184109758445, 0.68776789278625772,
+    0.67449982282743648, 0.66082257423420598, 0.64669571488438893,
+    0.63207223637502463, 0.61689698999623555, 0.60110461774394042,
+    0.58461676609372226, 0.56733825704047303, 0.54915170231302679,
+    0.52990972064649511, 0.50942332958593339, 0.48744396612175434,
+    0.46363433677176324, 0.43751840218666266, 0.40838913458800075,
+    0.37512133285046573, 0.33573751918045946, 0.28617459174726051,
+    0.21524189591327381, 0
+};
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,121 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BufferedPhiloxEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Span.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "sim/Types.hh"
+#include "PhiloxStatePointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Host Philox engine that serves draws from a batch-generated buffer.
+ *
+ * The buffer of \c N random words is refilled \c N/4 blocks at a time by the
+ * vectorized batch generator, so the cost of the Philox rounds is amortized
+ * over SIMD lanes rather than paid one block at a time. The stream is
+ * identical to that of \c PhiloxEngine with the same key and counter, and
+ * existing distributions use it unchanged through \c generate_canonical.
+ *
+ * Besides single draws, whole arrays of uniform values can be filled at once
+ * with \c fill_canonical; they consume the stream in the same order as
+ * repeated calls to \c generate_canonical.
+ */
+template<size_type N = 64>
+class BufferedPhiloxEngine
+{
+    static_assert(N > 0 && N % 4 == 0,
+                  "Buffer size must be a positive multiple of the block size");
+
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = unsigned int;
+    using Key         = PhiloxKey;
+    using Counter     = PhiloxCounter;
+    //!@}
+
+  public:
+    // Construct for the given step of a track
+    inline BufferedPhiloxEngine(const Key&   key,
+                                EventId      event,
+                                TrackId      track,
+                                unsigned int step);
+
+    // Construct from a key and starting counter
+    inline BufferedPhiloxEngine(const Key& key, const Counter& counter);
+
+    // Sample a random number
+    inline result_type operator()();
+
+    // Fill an array with floats on [0, 1)
+    inline void fill_canonical(Span<float> values);
+
+    // Fill an array with doubles on [0, 1)
+    inline void fill_canonical(Span<double> values);
+
+    //!@{
+    //! Range of generated values
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return 0u; }
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return 0xffffffffu; }
+    //!@}
+
+  private:
+    Key                     key_;
+    Counter                 counter_;
+    Array<unsigned int, N>  buffer_;
+    size_type               index_;
+
+    inline void refill();
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for BufferedPhiloxEngine, float.
+ */
+template<size_type N>
+class GenerateCanonical<BufferedPhiloxEngine<N>, float>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = float;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Sample a random number
+    inline result_type operator()(BufferedPhiloxEngine<N>& rng);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for BufferedPhiloxEngine, double.
+ */
+template<size_type N>
+class GenerateCanonical<BufferedPhiloxEngine<N>, double>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = double;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Sample a random number
+    inline result_type operator()(BufferedPhiloxEngine<N>& rng);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "BufferedPhiloxEngine.i.hh"
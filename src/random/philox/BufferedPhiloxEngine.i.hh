@@ -0,0 +1,163 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BufferedPhiloxEngine.i.hh
+//---------------------------------------------------------------------------//
+
+#include "detail/PhiloxImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct for the given step of a track.
+ */
+template<size_type N>
+BufferedPhiloxEngine<N>::BufferedPhiloxEngine(const Key&   key,
+                                              EventId      event,
+                                              TrackId      track,
+                                              unsigned int step)
+    : BufferedPhiloxEngine(key, Counter{0u, step, track.get(), event.get()})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a key and starting counter.
+ *
+ * The buffer is filled lazily at the first draw.
+ */
+template<size_type N>
+BufferedPhiloxEngine<N>::BufferedPhiloxEngine(const Key&     key,
+                                              const Counter& counter)
+    : key_(key), counter_(counter), index_(N)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random number.
+ */
+template<size_type N>
+auto BufferedPhiloxEngine<N>::operator()() -> result_type
+{
+    if (index_ == N)
+    {
+        this->refill();
+    }
+    return buffer_[index_++];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill an array with floats on [0, 1).
+ */
+template<size_type N>
+void BufferedPhiloxEngine<N>::fill_canonical(Span<float> values)
+{
+    float*    out       = values.data();
+    size_type remaining = values.size();
+    while (remaining > 0)
+    {
+        if (index_ == N)
+        {
+            this->refill();
+        }
+        size_type count = N - index_;
+        if (count > remaining)
+        {
+            count = remaining;
+        }
+
+        const unsigned int* in = buffer_.data() + index_;
+        for (size_type i = 0; i < count; ++i)
+        {
+            out[i] = detail::canonical_float(in[i]);
+        }
+        index_ += count;
+        out += count;
+        remaining -= count;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill an array with doubles on [0, 1).
+ */
+template<size_type N>
+void BufferedPhiloxEngine<N>::fill_canonical(Span<double> values)
+{
+    double*   out       = values.data();
+    size_type remaining = values.size();
+    while (remaining > 0)
+    {
+        if (index_ == N)
+        {
+            this->refill();
+        }
+        size_type count = (N - index_) / 2;
+        if (count == 0)
+        {
+            // Value straddles the end of the buffer
+            unsigned int first = (*this)();
+            *out++             = detail::canonical_double(first, (*this)());
+            --remaining;
+            continue;
+        }
+        if (count > remaining)
+        {
+            count = remaining;
+        }
+
+        const unsigned int* in = buffer_.data() + index_;
+        for (size_type i = 0; i < count; ++i)
+        {
+            out[i] = detail::canonical_double(in[2 * i], in[2 * i + 1]);
+        }
+        index_ += 2 * count;
+        out += count;
+        remaining -= count;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate the next N/4 blocks.
+ */
+template<size_type N>
+void BufferedPhiloxEngine<N>::refill()
+{
+    detail::philox_generate_blocks(key_, counter_, N / 4, buffer_.data());
+    counter_[0] += static_cast<unsigned int>(N / 4);
+    index_ = 0;
+}
+
+//---------------------------------------------------------------------------//
+// Specializations for GenerateCanonical
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a float on [0, 1) from the upper 24 bits of one draw.
+ */
+template<size_type N>
+float GenerateCanonical<BufferedPhiloxEngine<N>, float>::operator()(
+    BufferedPhiloxEngine<N>& rng)
+{
+    return detail::canonical_float(rng());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a double on [0, 1) from 53 bits of two draws.
+ */
+template<size_type N>
+double GenerateCanonical<BufferedPhiloxEngine<N>, double>::operator()(
+    BufferedPhiloxEngine<N>& rng)
+{
+    unsigned int first = rng();
+    return detail::canonical_double(first, rng());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "random/distributions/GenerateCanonical.hh"
+#include "sim/Types.hh"
+#include "PhiloxStatePointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Counter-based random number engine (Philox4x32-10).
+ *
+ * Each block of four 32-bit outputs is a bijective function of a 128-bit
+ * counter and a 64-bit key (Salmon et al., "Parallel random numbers: as easy
+ * as 1, 2, 3", SC11). The key is derived from the global seed, and the
+ * counter from the event ID, track ID, and step number of the track, with the
+ * lowest word counting blocks within the step:
+ * \verbatim
+   counter = {block, step, track, event}
+   \endverbatim
+ *
+ * The stream of a track therefore does not depend on which slot the track
+ * occupies or on how many threads execute it, and the engine needs no stored
+ * state beyond the step counter of each slot.
+ *
+ * \code
+    PhiloxEngine rng(state, tid, sim.event_id(), sim.track_id());
+    real_type u = generate_canonical(rng);
+   \endcode
+ */
+class PhiloxEngine
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = unsigned int;
+    using Key         = PhiloxKey;
+    using Counter     = PhiloxCounter;
+    //!@}
+
+  public:
+    // Construct for the current step of the track in a slot
+    inline CELER_FUNCTION PhiloxEngine(const PhiloxStatePointers& state,
+                                       ThreadId                   id,
+                                       EventId                    event,
+                                       TrackId                    track);
+
+    // Construct for the given step of a track
+    inline CELER_FUNCTION
+    PhiloxEngine(const Key& key, EventId event, TrackId track, unsigned int step);
+
+    // Construct from a key and starting counter
+    inline CELER_FUNCTION PhiloxEngine(const Key& key, const Counter& counter);
+
+    // Sample a random number
+    inline CELER_FUNCTION result_type operator()();
+
+    //!@{
+    //! Range of generated values
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return 0u; }
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return 0xffffffffu; }
+    //!@}
+
+    // Apply the Philox4x32-10 bijection to a counter
+    static inline CELER_FUNCTION Counter generate_block(Counter    counter,
+                                                        Key        key);
+
+  private:
+    Key          key_;
+    Counter      counter_;
+    Counter      block_;
+    unsigned int index_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for PhiloxEngine, float.
+ */
+template<>
+class GenerateCanonical<PhiloxEngine, float>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = float;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Sample a random number
+    inline CELER_FUNCTION result_type operator()(PhiloxEngine& rng);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for PhiloxEngine, double.
+ */
+template<>
+class GenerateCanonical<PhiloxEngine, double>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = double;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Sample a random number
+    inline CELER_FUNCTION result_type operator()(PhiloxEngine& rng);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "PhiloxEngine.i.hh"
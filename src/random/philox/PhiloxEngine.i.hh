@@ -0,0 +1,118 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxEngine.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "detail/PhiloxImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct for the current step of the track in a slot.
+ */
+CELER_FUNCTION PhiloxEngine::PhiloxEngine(const PhiloxStatePointers& state,
+                                          ThreadId                   id,
+                                          EventId                    event,
+                                          TrackId                    track)
+    : PhiloxEngine(state.key, event, track, state.step[id.get()])
+{
+    CELER_EXPECT(id < state.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct for the given step of a track.
+ */
+CELER_FUNCTION PhiloxEngine::PhiloxEngine(const Key&   key,
+                                          EventId      event,
+                                          TrackId      track,
+                                          unsigned int step)
+    : PhiloxEngine(key, Counter{0u, step, track.get(), event.get()})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a key and starting counter.
+ */
+CELER_FUNCTION
+PhiloxEngine::PhiloxEngine(const Key& key, const Counter& counter)
+    : key_(key), counter_(counter), block_{}, index_(4)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random number.
+ *
+ * A new block of four values is generated for every fourth call.
+ */
+CELER_FUNCTION auto PhiloxEngine::operator()() -> result_type
+{
+    if (index_ == 4)
+    {
+        block_ = generate_block(counter_, key_);
+        ++counter_[0];
+        index_ = 0;
+    }
+    return block_[index_++];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Philox4x32-10 bijection to a counter.
+ */
+CELER_FUNCTION auto PhiloxEngine::generate_block(Counter ctr, Key key)
+    -> Counter
+{
+    for (unsigned int r = 0; r < detail::philox_nrounds; ++r)
+    {
+        if (r > 0)
+        {
+            key[0] += detail::philox_weyl_0;
+            key[1] += detail::philox_weyl_1;
+        }
+        unsigned long long p0
+            = static_cast<unsigned long long>(detail::philox_mult_0) * ctr[0];
+        unsigned long long p1
+            = static_cast<unsigned long long>(detail::philox_mult_1) * ctr[2];
+        auto hi0 = static_cast<unsigned int>(p0 >> 32);
+        auto lo0 = static_cast<unsigned int>(p0);
+        auto hi1 = static_cast<unsigned int>(p1 >> 32);
+        auto lo1 = static_cast<unsigned int>(p1);
+
+        ctr = {hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0};
+    }
+    return ctr;
+}
+
+//---------------------------------------------------------------------------//
+// Specializations for GenerateCanonical
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a float on [0, 1) from the upper 24 bits of one draw.
+ */
+CELER_FUNCTION float
+GenerateCanonical<PhiloxEngine, float>::operator()(PhiloxEngine& rng)
+{
+    return detail::canonical_float(rng());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a double on [0, 1) from 53 bits of two draws.
+ */
+CELER_FUNCTION double
+GenerateCanonical<PhiloxEngine, double>::operator()(PhiloxEngine& rng)
+{
+    unsigned int first = rng();
+    return detail::canonical_double(first, rng());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,55 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxStatePointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! Philox4x32 key and counter
+using PhiloxKey     = Array<unsigned int, 2>;
+using PhiloxCounter = Array<unsigned int, 4>;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Split a 64-bit seed into a Philox key.
+ */
+CELER_CONSTEXPR_FUNCTION PhiloxKey make_philox_key(unsigned long long seed)
+{
+    return {static_cast<unsigned int>(seed),
+            static_cast<unsigned int>(seed >> 32)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Data needed to derive the random stream of a track in each slot.
+ *
+ * The only per-slot data is the step counter of the track in the slot: it
+ * must be reset to zero when a new track is initialized in the slot and
+ * incremented once per step.
+ */
+struct PhiloxStatePointers
+{
+    PhiloxKey          key{};
+    Span<unsigned int> step;
+
+    //! Whether the interface is initialized
+    explicit CELER_FUNCTION operator bool() const { return !step.empty(); }
+
+    //! State size
+    CELER_FUNCTION size_type size() const { return step.size(); }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,83 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxStateStore.cc
+//---------------------------------------------------------------------------//
+#include "PhiloxStateStore.hh"
+
+#include <vector>
+#include "base/Assert.hh"
+#include "comm/Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of track slots.
+ */
+PhiloxStateStore::PhiloxStateStore(size_type          size,
+                                   MemSpace           space,
+                                   unsigned long long seed)
+    : key_(make_philox_key(seed)), step_(size, space)
+{
+    CELER_EXPECT(space == MemSpace::host || celeritas::is_device_enabled());
+    CELER_EXPECT(size > 0);
+
+    // Start all slots at the first step
+    std::vector<unsigned int> zeros(size, 0u);
+    step_.copy_to_device(make_span(zeros));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a key and saved step counters.
+ */
+PhiloxStateStore::PhiloxStateStore(PhiloxKey                key,
+                                   Span<const unsigned int> steps,
+                                   MemSpace                 space)
+    : key_(key), step_(steps.size(), space)
+{
+    CELER_EXPECT(space == MemSpace::host || celeritas::is_device_enabled());
+    CELER_EXPECT(!steps.empty());
+
+    step_.copy_to_device(steps);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return a view to the states in their memory space.
+ */
+PhiloxStatePointers PhiloxStateStore::device_pointers()
+{
+    CELER_EXPECT(!step_.empty());
+
+    PhiloxStatePointers result;
+    result.key  = key_;
+    result.step = step_.device_pointers();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the step counters to host memory.
+ */
+void PhiloxStateStore::copy_to_host(Span<unsigned int> host_steps) const
+{
+    CELER_EXPECT(host_steps.size() == this->size());
+    step_.copy_to_host(host_steps);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Overwrite the step counters with the given host values.
+ */
+void PhiloxStateStore::copy_to_device(Span<const unsigned int> host_steps)
+{
+    CELER_EXPECT(host_steps.size() == this->size());
+    step_.copy_to_device(host_steps);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,65 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxStateStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "PhiloxStatePointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Manage ownership of counter-based random number generator states.
+ *
+ * Each slot stores only the step counter of its track (four bytes, compared
+ * to 48 for an XORWOW state), and no initialization kernel is needed. The
+ * key and counters can be copied out and back in (see \c RngCheckpoint.hh)
+ * to save and restore a run, or to replay the stream of a single track.
+ */
+class PhiloxStateStore
+{
+  public:
+    // Empty constructor
+    PhiloxStateStore() = default;
+
+    // Construct with the number of track slots
+    PhiloxStateStore(size_type          size,
+                     MemSpace           space,
+                     unsigned long long seed = 12345u);
+
+    // Construct from a key and saved step counters
+    PhiloxStateStore(PhiloxKey                key,
+                     Span<const unsigned int> steps,
+                     MemSpace                 space);
+
+    //! Key shared by all track streams
+    const PhiloxKey& key() const { return key_; }
+
+    //! Number of states
+    size_type size() const { return step_.size(); }
+
+    //! Memory space of the states
+    MemSpace memspace() const { return step_.memspace(); }
+
+    // Access pointers to the states
+    PhiloxStatePointers device_pointers();
+
+    // Copy the step counters to host memory
+    void copy_to_host(Span<unsigned int> host_steps) const;
+
+    // Overwrite the step counters
+    void copy_to_device(Span<const unsigned int> host_steps);
+
+  private:
+    PhiloxKey                  key_{};
+    DeviceVector<unsigned int> step_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,120 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "../PhiloxStatePointers.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Philox4x32-10 multipliers, key increments, and number of rounds
+enum : unsigned int
+{
+    philox_mult_0  = 0xD2511F53u,
+    philox_mult_1  = 0xCD9E8D57u,
+    philox_weyl_0  = 0x9E3779B9u,
+    philox_weyl_1  = 0xBB67AE85u,
+    philox_nrounds = 10u
+};
+
+//! Number of blocks generated together by the batch generator
+constexpr size_type philox_batch_width = 16;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the upper 24 bits of a random word to a float on [0, 1).
+ */
+CELER_FORCEINLINE_FUNCTION float canonical_float(unsigned int bits)
+{
+    return static_cast<float>(bits >> 8u) * 5.9604644775390625e-8f;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert 53 bits of two random words to a double on [0, 1).
+ */
+CELER_FORCEINLINE_FUNCTION double
+canonical_double(unsigned int first, unsigned int second)
+{
+    return static_cast<double>(first >> 5u) * 7.450580596923828125e-9
+           + static_cast<double>(second >> 6u) * 1.1102230246251565e-16;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate consecutive Philox blocks on host.
+ *
+ * Block \c b uses the given counter with its lowest word incremented by \c b,
+ * and its four words are written to <tt>out[4 * b]</tt> through
+ * <tt>out[4 * b + 3]</tt>, which is the same stream as consecutive calls to
+ * \c PhiloxEngine. Blocks are computed in groups of \c philox_batch_width
+ * independent lanes: the fixed number of rounds is fully unrolled, leaving a
+ * branch-free loop over lanes that the compiler vectorizes at the native
+ * SIMD width of the target (e.g. eight 32-bit lanes for AVX2, sixteen for
+ * AVX-512) without any architecture-specific code.
+ */
+inline void philox_generate_blocks(const PhiloxKey& key,
+                                   PhiloxCounter    counter,
+                                   size_type        num_blocks,
+                                   unsigned int*    out)
+{
+    constexpr size_type width = philox_batch_width;
+
+    while (num_blocks > 0)
+    {
+        const size_type count = num_blocks < width ? num_blocks : width;
+
+        unsigned int c0[width], c1[width], c2[width], c3[width];
+        for (size_type i = 0; i < width; ++i)
+        {
+            unsigned int x0 = counter[0] + static_cast<unsigned int>(i);
+            unsigned int x1 = counter[1];
+            unsigned int x2 = counter[2];
+            unsigned int x3 = counter[3];
+            unsigned int k0 = key[0];
+            unsigned int k1 = key[1];
+            for (unsigned int r = 0; r < philox_nrounds; ++r)
+            {
+                unsigned long long p0
+                    = static_cast<unsigned long long>(philox_mult_0) * x0;
+                unsigned long long p1
+                    = static_cast<unsigned long long>(philox_mult_1) * x2;
+                x0 = static_cast<unsigned int>(p1 >> 32) ^ x1 ^ k0;
+                x1 = static_cast<unsigned int>(p1);
+                x2 = static_cast<unsigned int>(p0 >> 32) ^ x3 ^ k1;
+                x3 = static_cast<unsigned int>(p0);
+                k0 += philox_weyl_0;
+                k1 += philox_weyl_1;
+            }
+            c0[i] = x0;
+            c1[i] = x1;
+            c2[i] = x2;
+            c3[i] = x3;
+        }
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            out[4 * i + 0] = c0[i];
+            out[4 * i + 1] = c1[i];
+            out[4 * i + 2] = c2[i];
+            out[4 * i + 3] = c3[i];
+        }
+
+        counter[0] += static_cast<unsigned int>(count);
+        out += 4 * count;
+        num_blocks -= count;
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -8,7 +8,7 @@
 #pragma once
 
 #include "base/Macros.hh"
-#include "base/Span.hh"
+#include "base/StateCollection.hh"
 #include "base/Types.hh"
 #include "Types.hh"
 
@@ -26,13 +26,34 @@ struct SimTrackState
     bool    alive = false; //!< Whether this track is alive
 };
 
+//---------------------------------------------------------------------------//
+//! Memory layout of simulation track states
+using SimStateLayout = layout::SoA;
+
 //---------------------------------------------------------------------------//
 /*!
  * View to the simulation states of multiple tracks.
+ *
+ * The fields of \c SimTrackState are stored according to \c SimStateLayout.
  */
 struct SimStatePointers
 {
-    Span<SimTrackState> vars;
+    //! Field indices in the state collection
+    struct Fields
+    {
+        enum : size_type
+        {
+            track_id,
+            parent_id,
+            event_id,
+            alive
+        };
+    };
+
+    using Collection
+        = StateCollection<SimStateLayout, TrackId, TrackId, EventId, bool>;
+
+    Collection vars;
 
     //! Check whether the interface is initialized
     explicit CELER_FUNCTION operator bool() const { return !vars.empty(); }
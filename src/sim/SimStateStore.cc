@@ -7,8 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "SimStateStore.hh"
 
-#include <vector>
-#include "base/Array.hh"
+#include "base/StateCollectionStore.t.hh"
 #include "SimStatePointers.hh"
 #include "detail/SimStateInit.hh"
 
@@ -21,8 +20,34 @@ namespace celeritas
 SimStateStore::SimStateStore(size_type size) : vars_(size)
 {
     CELER_EXPECT(size > 0);
+    this->initialize();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with number of parallel tracks in a given memory space.
+ */
+SimStateStore::SimStateStore(size_type size, MemSpace space)
+    : vars_(size, space)
+{
+    CELER_EXPECT(size > 0);
+    this->initialize();
+}
 
-    detail::sim_state_init_device(this->device_pointers());
+//---------------------------------------------------------------------------//
+/*!
+ * Mark all track states as inactive.
+ */
+void SimStateStore::initialize()
+{
+    if (vars_.memspace() == MemSpace::device)
+    {
+        detail::sim_state_init_device(this->device_pointers());
+    }
+    else
+    {
+        detail::sim_state_init_host(this->device_pointers());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "base/DeviceVector.hh"
+#include "base/StateCollectionStore.hh"
 #include "base/Types.hh"
 #include "SimStatePointers.hh"
 
@@ -23,6 +23,9 @@ class SimStateStore
     // Construct from number of track states
     explicit SimStateStore(size_type size);
 
+    // Construct from number of track states in a given memory space
+    SimStateStore(size_type size, MemSpace space);
+
     //// ACCESSORS ////
 
     // Number of states
@@ -32,7 +35,10 @@ class SimStateStore
     SimStatePointers device_pointers();
 
   private:
-    DeviceVector<SimTrackState> vars_;
+    StateCollectionStore<SimStatePointers::Collection> vars_;
+
+    // Mark all track states as inactive
+    void initialize();
 };
 
 //---------------------------------------------------------------------------//
@@ -39,19 +39,37 @@ class SimTrackView
 
     //!@{
     //! State accessors
-    CELER_FUNCTION TrackId track_id() const { return state_.track_id; }
-    CELER_FUNCTION TrackId parent_id() const { return state_.parent_id; }
-    CELER_FUNCTION EventId event_id() const { return state_.event_id; }
-    CELER_FUNCTION bool    alive() const { return state_.alive; }
+    CELER_FUNCTION TrackId track_id() const
+    {
+        return states_.get<Fields::track_id>(thread_);
+    }
+    CELER_FUNCTION TrackId parent_id() const
+    {
+        return states_.get<Fields::parent_id>(thread_);
+    }
+    CELER_FUNCTION EventId event_id() const
+    {
+        return states_.get<Fields::event_id>(thread_);
+    }
+    CELER_FUNCTION bool alive() const
+    {
+        return states_.get<Fields::alive>(thread_);
+    }
     //!@}
 
     //!@{
     //! State modifiers via non-const references
-    CELER_FUNCTION bool& alive() { return state_.alive; }
+    CELER_FUNCTION bool& alive()
+    {
+        return states_.get<Fields::alive>(thread_);
+    }
     //!@}
 
   private:
-    SimTrackState& state_;
+    using Fields = SimStatePointers::Fields;
+
+    SimStatePointers::Collection states_;
+    ThreadId                     thread_;
 };
 
 //---------------------------------------------------------------------------//
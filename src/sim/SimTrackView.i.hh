@@ -14,7 +14,7 @@ namespace celeritas
  */
 CELER_FUNCTION
 SimTrackView::SimTrackView(const SimStatePointers& states, ThreadId id)
-    : state_(states.vars[id.get()])
+    : states_(states.vars), thread_(id)
 {
     CELER_EXPECT(id < states.vars.size());
 }
@@ -25,7 +25,10 @@ SimTrackView::SimTrackView(const SimStatePointers& states, ThreadId id)
  */
 CELER_FUNCTION SimTrackView& SimTrackView::operator=(const Initializer_t& other)
 {
-    state_ = other;
+    states_.get<Fields::track_id>(thread_)  = other.track_id;
+    states_.get<Fields::parent_id>(thread_) = other.parent_id;
+    states_.get<Fields::event_id>(thread_)  = other.event_id;
+    states_.get<Fields::alive>(thread_)     = other.alive;
     return *this;
 }
 
@@ -8,6 +8,7 @@
 #include "TrackInitializerStore.hh"
 
 #include <numeric>
+#include "base/ScopedDeviceTimer.hh"
 #include "detail/InitializeTracks.hh"
 
 namespace celeritas
@@ -94,6 +95,7 @@ void TrackInitializerStore::extend_from_primaries()
         primaries_.resize(primaries_.size() - count);
 
         // Launch a kernel to create track initializers from primaries
+        ScopedDeviceTimer time_primaries("process_primaries");
         detail::process_primaries(primaries.device_pointers(),
                                   this->device_pointers());
     }
@@ -164,9 +166,12 @@ void TrackInitializerStore::extend_from_secondaries(StateStore& states,
 
     // Launch a kernel to identify which track slots are still alive and count
     // the number of surviving secondaries per track
-    detail::locate_alive(states.device_pointers(),
-                         params.device_pointers(),
-                         this->device_pointers());
+    {
+        ScopedDeviceTimer time_locate("locate_alive");
+        detail::locate_alive(states.device_pointers(),
+                             params.device_pointers(),
+                             this->device_pointers());
+    }
 
     // Remove all elements in the vacancy vector that were flagged as active
     // tracks, leaving the (sorted) indices of the empty slots
@@ -195,9 +200,12 @@ void TrackInitializerStore::extend_from_secondaries(StateStore& states,
     // Launch a kernel to create track initializers from secondaries
     parent_.resize(num_secondaries);
     initializers_.resize(initializers_.size() + num_secondaries);
-    detail::process_secondaries(states.device_pointers(),
-                                params.device_pointers(),
-                                this->device_pointers());
+    {
+        ScopedDeviceTimer time_secondaries("process_secondaries");
+        detail::process_secondaries(states.device_pointers(),
+                                    params.device_pointers(),
+                                    this->device_pointers());
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -218,6 +226,7 @@ void TrackInitializerStore::initialize_tracks(StateStore& states,
     if (num_tracks > 0)
     {
         // Launch a kernel to initialize tracks on device
+        ScopedDeviceTimer time_init("initialize_tracks");
         detail::init_tracks(states.device_pointers(),
                             params.device_pointers(),
                             this->device_pointers());
@@ -0,0 +1,32 @@
+//---------------------------------*-C++-*-----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SimStateInit.cc
+//---------------------------------------------------------------------------//
+#include "SimStateInit.hh"
+
+#include "base/Assert.hh"
+#include "base/HostKernelLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the sim states on host.
+ */
+void sim_state_init_host(const SimStatePointers& host_ptrs)
+{
+    CELER_EXPECT(host_ptrs);
+    HostKernelLauncher launch_kernel("sim_init");
+    launch_kernel(host_ptrs.size(), [&host_ptrs](ThreadId tid) {
+        sim_state_init_thread(host_ptrs, tid);
+    });
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -9,7 +9,6 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "../SimTrackView.hh"
 
 namespace celeritas
 {
@@ -28,8 +27,7 @@ __global__ void sim_init_kernel(const SimStatePointers state)
     auto tid = celeritas::KernelParamCalculator::thread_id();
     if (tid.get() < state.size())
     {
-        SimTrackView sim_view(state, tid);
-        sim_view = SimTrackView::Initializer_t{};
+        sim_state_init_thread(state, tid);
     }
 }
 //---------------------------------------------------------------------------//
@@ -7,8 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Macros.hh"
 #include "base/Span.hh"
 #include "../SimStatePointers.hh"
+#include "../SimTrackView.hh"
 
 namespace celeritas
 {
@@ -18,6 +20,20 @@ namespace detail
 // Initialize the sim state on device
 void sim_state_init_device(const SimStatePointers& device_ptrs);
 
+// Initialize the sim state on host
+void sim_state_init_host(const SimStatePointers& host_ptrs);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize a single sim state (setting 'alive' to false).
+ */
+inline CELER_FUNCTION void
+sim_state_init_thread(const SimStatePointers& state, ThreadId tid)
+{
+    SimTrackView sim_view(state, tid);
+    sim_view = SimTrackView::Initializer_t{};
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
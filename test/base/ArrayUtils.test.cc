@@ -112,3 +112,23 @@ TEST(ArrayUtilsTest, rotate)
     vec      = celeritas::rotate(scatter, {0.0, 0.0, 1.0});
     EXPECT_VEC_SOFT_EQ(expected, vec);
 }
+
+TEST(ArrayUtilsTest, rotate_azimuth)
+{
+    Real3 vec = {-1.1, 2.3, 0.9};
+    celeritas::normalize_direction(&vec);
+
+    double costheta = std::cos(2.0 / 3.0);
+    double phi      = 2 * celeritas::constants::pi / 3.0;
+    celeritas::Array<double, 2> azimuth = {std::cos(phi), std::sin(phi)};
+
+    EXPECT_VEC_SOFT_EQ(celeritas::from_spherical(costheta, phi),
+                       celeritas::from_spherical(costheta, azimuth));
+    EXPECT_VEC_SOFT_EQ(
+        celeritas::rotate(celeritas::from_spherical(costheta, phi), vec),
+        celeritas::rotate(costheta, azimuth, vec));
+    EXPECT_VEC_SOFT_EQ(
+        celeritas::rotate(celeritas::from_spherical(-costheta, phi),
+                          {0.0, 0.0, -1.0}),
+        celeritas::rotate(-costheta, azimuth, {0.0, 0.0, -1.0}));
+}
@@ -0,0 +1,130 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Atomics.test.cc
+//---------------------------------------------------------------------------//
+#include "base/Atomics.hh"
+
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using celeritas::atomic_add;
+using celeritas::atomic_cas;
+using celeritas::atomic_max;
+using celeritas::atomic_min;
+using celeritas::MemOrder;
+using celeritas::ull_int;
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+
+constexpr int num_threads = 8;
+constexpr int num_iters   = 10000;
+
+//! Call a function from many threads at once
+template<class F>
+void run_threaded(F func)
+{
+    std::vector<std::thread> threads;
+    for (int t : celeritas::range(num_threads))
+    {
+        threads.emplace_back([t, &func] {
+            for (int i : celeritas::range(num_iters))
+            {
+                func(t, i);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(AtomicsTest, serial)
+{
+    int i = 10;
+    EXPECT_EQ(10, atomic_add(&i, 3));
+    EXPECT_EQ(13, atomic_min(&i, 20));
+    EXPECT_EQ(13, i);
+    EXPECT_EQ(13, atomic_min(&i, 5));
+    EXPECT_EQ(5, atomic_max(&i, 2));
+    EXPECT_EQ(5, atomic_max(&i, 7));
+    EXPECT_EQ(7, i);
+    EXPECT_EQ(7, atomic_cas(&i, 6, 100));
+    EXPECT_EQ(7, i);
+    EXPECT_EQ(7, atomic_cas<MemOrder::acq_rel>(&i, 7, 100));
+    EXPECT_EQ(100, i);
+
+    double d = 1.5;
+    EXPECT_EQ(1.5, atomic_add(&d, 2.0));
+    EXPECT_EQ(3.5, atomic_max(&d, -1.0));
+    EXPECT_EQ(3.5, atomic_min(&d, -1.0));
+    EXPECT_EQ(-1.0, d);
+
+    // Compare-and-swap loop must terminate for NaN
+    d = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(std::isnan(atomic_add(&d, 1.0)));
+    EXPECT_TRUE(std::isnan(d));
+}
+
+TEST(AtomicsTest, threaded_add)
+{
+    ull_int counter = 0;
+    double  sum     = 0;
+    run_threaded([&](int, int) {
+        atomic_add(&counter, ull_int(2));
+        atomic_add<MemOrder::acq_rel>(&sum, 0.5);
+    });
+    EXPECT_EQ(2 * num_threads * num_iters, counter);
+    EXPECT_EQ(0.5 * num_threads * num_iters, sum);
+}
+
+TEST(AtomicsTest, threaded_minmax)
+{
+    int    lo   = 0;
+    int    hi   = 0;
+    double dmax = 0;
+    run_threaded([&](int t, int i) {
+        int value = t * num_iters + i;
+        atomic_min(&lo, -value);
+        atomic_max<MemOrder::acq_rel>(&hi, value);
+        atomic_max(&dmax, static_cast<double>(value));
+    });
+    EXPECT_EQ(-(num_threads * num_iters - 1), lo);
+    EXPECT_EQ(num_threads * num_iters - 1, hi);
+    EXPECT_EQ(num_threads * num_iters - 1, dmax);
+}
+
+TEST(AtomicsTest, threaded_cas)
+{
+    // Each thread claims unique slots by advancing a shared index via CAS
+    unsigned int     next = 0;
+    std::vector<int> claimed(num_threads * num_iters, 0);
+    run_threaded([&](int, int) {
+        unsigned int expected = next;
+        unsigned int actual;
+        while ((actual = atomic_cas(&next, expected, expected + 1))
+               != expected)
+        {
+            expected = actual;
+        }
+        claimed[expected] += 1;
+    });
+    EXPECT_EQ(num_threads * num_iters, next);
+    for (int c : claimed)
+    {
+        ASSERT_EQ(1, c);
+    }
+}
@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Collection.test.cc
+//---------------------------------------------------------------------------//
+#include "base/Collection.hh"
+
+#include <vector>
+#include "base/CollectionArena.hh"
+#include "base/CollectionBuilder.hh"
+#include "celeritas_test.hh"
+
+using celeritas::Byte;
+using celeritas::Collection;
+using celeritas::CollectionArena;
+using celeritas::ItemId;
+using celeritas::ItemRange;
+using celeritas::make_builder;
+using celeritas::make_span;
+using celeritas::real_type;
+using celeritas::Span;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// Pointer-free struct referring to other items
+struct Shell
+{
+    int                  index;
+    ItemRange<real_type> params;
+};
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ItemRangeTest, accessors)
+{
+    ItemRange<real_type> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(0, empty.size());
+
+    ItemRange<real_type> r{ItemId<real_type>{3}, ItemId<real_type>{7}};
+    EXPECT_FALSE(r.empty());
+    EXPECT_EQ(4, r.size());
+    EXPECT_EQ(ItemId<real_type>{3}, r.begin());
+    EXPECT_EQ(ItemId<real_type>{7}, r.end());
+    EXPECT_EQ(ItemId<real_type>{5}, r[2]);
+}
+
+TEST(CollectionTest, builder)
+{
+    std::vector<real_type> reals;
+    auto                   build = make_builder(&reals);
+
+    auto first  = build.push_back(1.5);
+    auto values = {2.0, 3.0, 4.0};
+    auto range  = build.insert_back(values.begin(), values.end());
+    auto extra  = build.resize_back(2);
+    EXPECT_EQ(6, build.size());
+    EXPECT_EQ(0, first.get());
+    EXPECT_EQ(3, range.size());
+    EXPECT_EQ(ItemId<real_type>{4}, extra.begin());
+    build[extra][1] = 10.0;
+
+    Collection<const real_type> collection(make_span(reals));
+    EXPECT_EQ(6, collection.size());
+    EXPECT_EQ(1.5, collection[first]);
+    Span<const real_type> span = collection[range];
+    ASSERT_EQ(3, span.size());
+    EXPECT_EQ(2.0, span[0]);
+    EXPECT_EQ(4.0, span[2]);
+    EXPECT_EQ(10.0, collection[extra][1]);
+}
+
+TEST(CollectionTest, arena)
+{
+    std::vector<real_type> reals;
+    std::vector<Shell>     shells;
+    {
+        auto build_reals = make_builder(&reals);
+        auto p           = {1.0, 2.0};
+        shells.push_back({0, build_reals.insert_back(p.begin(), p.end())});
+        auto q = {3.0, 4.0, 5.0};
+        shells.push_back({1, build_reals.insert_back(q.begin(), q.end())});
+    }
+    std::vector<char> chars = {'a', 'b', 'c'};
+
+    CollectionArena arena;
+    auto            chars_slot  = arena.insert(make_span(chars));
+    auto            shells_slot = arena.insert(make_span(shells));
+    auto            reals_slot  = arena.insert(make_span(reals));
+    EXPECT_EQ(0, shells_slot.offset % CollectionArena::alignment);
+    EXPECT_EQ(0, reals_slot.offset % CollectionArena::alignment);
+    EXPECT_EQ(3, chars_slot.size);
+    EXPECT_LE(reals_slot.offset + 5 * sizeof(real_type), arena.num_bytes());
+    EXPECT_FALSE(arena.has_device_data());
+
+    // Resolve ranges on host
+    Collection<const Shell>     host_shells(arena.host_view(shells_slot));
+    Collection<const real_type> host_reals(arena.host_view(reals_slot));
+    ASSERT_EQ(2, host_shells.size());
+    Span<const real_type> params
+        = host_reals[host_shells[ItemId<Shell>{1}].params];
+    ASSERT_EQ(3, params.size());
+    EXPECT_EQ(3.0, params[0]);
+    EXPECT_EQ(5.0, params[2]);
+
+    // Relocate the packed block: no fixups are needed
+    std::vector<Byte> copy(arena.host_data().begin(), arena.host_data().end());
+    Span<const Shell> copied_shells{
+        reinterpret_cast<const Shell*>(copy.data() + shells_slot.offset),
+        shells_slot.size};
+    EXPECT_EQ(host_shells[ItemId<Shell>{0}].params.begin(),
+              copied_shells[0].params.begin());
+    EXPECT_EQ(2, copied_shells[0].params.size());
+
+    // Copy to "device" with a single transfer
+    arena.copy_to_device();
+    EXPECT_TRUE(arena.has_device_data());
+    EXPECT_EQ(2, arena.device_view(shells_slot).size());
+    EXPECT_EQ(5, arena.device_view(reals_slot).size());
+}
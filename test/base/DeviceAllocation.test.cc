@@ -8,11 +8,13 @@
 #include "base/DeviceAllocation.hh"
 
 #include <algorithm>
+#include <cstdint>
 #include "celeritas_test.hh"
 #include "base/Span.hh"
 
 using celeritas::Byte;
 using celeritas::DeviceAllocation;
+using celeritas::MemSpace;
 
 TEST(InitializedValue, semantics)
 {
@@ -85,10 +87,9 @@ TEST_F(DeviceAllocationTest, all)
     EXPECT_TRUE(alloc.empty());
 
 #if !CELERITAS_USE_CUDA
-    // Can't allocate
-    EXPECT_THROW(DeviceAllocation(1234), celeritas::DebugError);
-    cout << "CUDA is disabled; skipping remainder of test." << endl;
-    return;
+    // Can't allocate on device
+    EXPECT_THROW(DeviceAllocation(1234, MemSpace::device),
+                 celeritas::DebugError);
 #endif
 
     alloc = DeviceAllocation(1024);
@@ -126,3 +127,29 @@ TEST_F(DeviceAllocationTest, all)
         EXPECT_EQ(orig_ptr, other.device_pointers().data());
     }
 }
+
+TEST_F(DeviceAllocationTest, host)
+{
+    DeviceAllocation alloc(100, MemSpace::host);
+    EXPECT_EQ(MemSpace::host, alloc.memspace());
+    EXPECT_EQ(100, alloc.size());
+
+    // Host allocations are aligned to a cache line
+    Byte* ptr = alloc.device_pointers().data();
+    EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(ptr) % 64);
+
+    std::vector<Byte> data(alloc.size(), Byte(3));
+    data.back() = Byte(200);
+    alloc.copy_to_device(celeritas::make_span(data));
+    EXPECT_EQ(Byte(3), ptr[0]);
+    EXPECT_EQ(Byte(200), ptr[99]);
+
+    std::vector<Byte> newdata(alloc.size());
+    alloc.copy_to_host(celeritas::make_span(newdata));
+    EXPECT_EQ(data, newdata);
+
+    // Move retains memory space
+    DeviceAllocation other(std::move(alloc));
+    EXPECT_EQ(MemSpace::host, other.memspace());
+    EXPECT_EQ(ptr, other.device_pointers().data());
+}
@@ -33,10 +33,9 @@ TEST_F(DeviceVectorTest, all)
     EXPECT_TRUE(vec.empty());
 
 #if !CELERITAS_USE_CUDA
-    // Can't allocate
-    EXPECT_THROW(Vec_t(1234), celeritas::DebugError);
-    cout << "CUDA is disabled; skipping remainder of test." << endl;
-    return;
+    // Can't allocate on device
+    EXPECT_THROW(Vec_t(1234, celeritas::MemSpace::device),
+                 celeritas::DebugError);
 #endif
 
     vec = Vec_t(1024);
@@ -71,6 +70,16 @@ TEST_F(DeviceVectorTest, all)
     EXPECT_EQ(1, newdata.front());
     EXPECT_EQ(1234567, newdata.back());
 
+    // Copy only the leading elements
+    const int leading[] = {2, 3};
+    vec.copy_to_device(celeritas::make_span(leading));
+    newdata.assign(3, 0);
+    vec.copy_to_host(celeritas::make_span(newdata));
+    EXPECT_VEC_EQ((std::vector<int>{2, 3, 0}), newdata);
+    newdata.resize(vec.size());
+    vec.copy_to_host(celeritas::make_span(newdata));
+    EXPECT_EQ(1234567, newdata.back());
+
     // Test move construction/assignment
     {
         int*  orig_vec = vec.device_pointers().data();
@@ -81,3 +90,23 @@ TEST_F(DeviceVectorTest, all)
         EXPECT_EQ(orig_vec, other.device_pointers().data());
     }
 }
+
+TEST_F(DeviceVectorTest, host)
+{
+    using celeritas::MemSpace;
+    DeviceVector<double> vec(10, MemSpace::host);
+    EXPECT_EQ(MemSpace::host, vec.memspace());
+
+    std::vector<double> data(vec.size(), 1.5);
+    vec.copy_to_device(celeritas::make_span(data));
+
+    // Host memory space data is directly accessible
+    auto ptrs = vec.device_pointers();
+    ASSERT_EQ(10, ptrs.size());
+    ptrs[9] = 3.0;
+
+    std::vector<double> newdata(vec.size());
+    vec.copy_to_host(celeritas::make_span(newdata));
+    EXPECT_EQ(1.5, newdata.front());
+    EXPECT_EQ(3.0, newdata.back());
+}
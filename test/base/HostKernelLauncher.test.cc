@@ -0,0 +1,207 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostKernelLauncher.test.cc
+//---------------------------------------------------------------------------//
+#include "base/HostKernelLauncher.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "base/Atomics.hh"
+#include "celeritas_test.hh"
+
+using celeritas::HostKernelLauncher;
+using celeritas::size_type;
+using celeritas::ThreadId;
+using celeritas::ThreadPool;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class HostKernelLauncherTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override { pool = std::make_shared<ThreadPool>(4); }
+
+    std::shared_ptr<ThreadPool> pool;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(HostKernelLauncherTest, thread_pool)
+{
+    EXPECT_EQ(4, pool->num_threads());
+
+    // Every index should be visited exactly once for all grain sizes
+    for (size_type grain_size : {1, 3, 64, 5000})
+    {
+        std::vector<int> visited(1000, 0);
+        pool->parallel_for(
+            visited.size(), grain_size, [&](size_type begin, size_type end) {
+                EXPECT_LE(end - begin, grain_size);
+                for (auto i : celeritas::range(begin, end))
+                {
+                    ++visited[i];
+                }
+            });
+        EXPECT_VEC_EQ(std::vector<int>(1000, 1), visited);
+    }
+
+    // Empty loop should not call the function
+    pool->parallel_for(0, 1, [](size_type, size_type) { FAIL(); });
+}
+
+TEST_F(HostKernelLauncherTest, work_stealing)
+{
+    pool->reset_stats();
+
+    // All the expensive work is in the first worker's initial range
+    std::vector<size_type> worker(64);
+    auto stats = pool->parallel_for(
+        worker.size(), 1, [&](size_type begin, size_type end) {
+            EXPECT_EQ(1, end - begin);
+            worker[begin] = ThreadPool::worker_index();
+            if (begin < 16)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        });
+
+    EXPECT_EQ(64, stats.num_tasks);
+    EXPECT_EQ(60, stats.num_splits);
+    EXPECT_GT(stats.num_steals, 0);
+    EXPECT_GT(stats.idle_time, 0);
+
+    // Expensive indices should have been processed by multiple threads
+    std::vector<int> used(pool->num_threads(), 0);
+    for (auto i : celeritas::range(16))
+    {
+        ASSERT_LT(worker[i], pool->num_threads());
+        used[worker[i]] = 1;
+    }
+    EXPECT_GT(std::count(used.begin(), used.end(), 1), 1);
+
+    // Accumulated stats should match
+    auto all_stats = pool->worker_stats();
+    ASSERT_EQ(4, all_stats.size());
+    ThreadPool::Stats total;
+    for (const auto& s : all_stats)
+    {
+        total += s;
+    }
+    EXPECT_EQ(stats.num_tasks, total.num_tasks);
+    EXPECT_EQ(stats.num_steals, total.num_steals);
+
+    pool->reset_stats();
+    EXPECT_EQ(0, pool->worker_stats().front().num_tasks);
+}
+
+TEST_F(HostKernelLauncherTest, serial)
+{
+    ThreadPool serial_pool(1);
+    EXPECT_EQ(1, serial_pool.num_threads());
+
+    std::vector<size_type> chunks;
+    serial_pool.parallel_for(10, 3, [&](size_type begin, size_type end) {
+        chunks.push_back(begin);
+        chunks.push_back(end);
+    });
+    const size_type expected_chunks[] = {0, 10};
+    EXPECT_VEC_EQ(expected_chunks, chunks);
+}
+
+TEST_F(HostKernelLauncherTest, nested)
+{
+    // Inner loops run serially on the thread executing the outer body
+    std::vector<size_type> inner_counts(64, 0);
+    pool->parallel_for(64, 1, [&](size_type begin, size_type end) {
+        for (auto i = begin; i != end; ++i)
+        {
+            size_type outer_worker = ThreadPool::worker_index();
+            pool->parallel_for(100, 10, [&](size_type ibegin, size_type iend) {
+                EXPECT_EQ(outer_worker, ThreadPool::worker_index());
+                inner_counts[i] += iend - ibegin;
+            });
+        }
+    });
+    EXPECT_EQ(std::vector<size_type>(64, 100), inner_counts);
+
+    // Pool should still be usable
+    size_type count = 0;
+    pool->parallel_for(100, 2, [&count](size_type begin, size_type end) {
+        celeritas::atomic_add(&count, end - begin);
+    });
+    EXPECT_EQ(100, count);
+}
+
+TEST_F(HostKernelLauncherTest, exception)
+{
+    auto throw_on_17 = [](size_type begin, size_type end) {
+        if (begin <= 17 && 17 < end)
+        {
+            throw std::runtime_error("bad index");
+        }
+    };
+    EXPECT_THROW(pool->parallel_for(100, 2, throw_on_17), std::runtime_error);
+
+    // Pool should still be usable
+    size_type count = 0;
+    pool->parallel_for(100, 2, [&count](size_type begin, size_type end) {
+        celeritas::atomic_add(&count, end - begin);
+    });
+    EXPECT_EQ(100, count);
+}
+
+TEST_F(HostKernelLauncherTest, launch)
+{
+    HostKernelLauncher launch_kernel("fill", pool);
+    EXPECT_EQ("fill", launch_kernel.label());
+    EXPECT_EQ(0, launch_kernel.grain_size());
+    EXPECT_EQ(0, launch_kernel.timing().num_launches);
+
+    std::vector<size_type> result(1234);
+    launch_kernel(result.size(), [&result](ThreadId tid) {
+        result[tid.get()] = 2 * tid.get();
+    });
+    for (auto i : celeritas::range(result.size()))
+    {
+        EXPECT_EQ(2 * i, result[i]);
+    }
+
+    launch_kernel.grain_size(7);
+    launch_kernel(result.size(), [&result](ThreadId tid) {
+        result[tid.get()] += 1;
+    });
+    for (auto i : celeritas::range(result.size()))
+    {
+        EXPECT_EQ(2 * i + 1, result[i]);
+    }
+
+    const auto& timing = launch_kernel.timing();
+    EXPECT_EQ(2, timing.num_launches);
+    EXPECT_LE(1234 / 7 + 1, timing.scheduling.num_tasks);
+    EXPECT_EQ(2 * result.size(), timing.num_threads);
+    EXPECT_GE(timing.time, 0);
+}
+
+TEST_F(HostKernelLauncherTest, global)
+{
+    HostKernelLauncher launch_kernel("global");
+    EXPECT_EQ(ThreadPool::global(), launch_kernel.pool());
+    EXPECT_GE(launch_kernel.pool()->num_threads(), 1);
+
+    size_type count = 0;
+    launch_kernel(100, [&count](ThreadId) {
+        celeritas::atomic_add(&count, size_type(1));
+    });
+    EXPECT_EQ(100, count);
+}
@@ -34,9 +34,11 @@ class HostStackAllocatorStore
     void resize(size_type capacity, value_type fill = {})
     {
         storage_.assign(capacity, fill);
-        size_             = 0;
-        pointers_.storage = celeritas::make_span(storage_);
-        pointers_.size    = &size_;
+        size_              = 0;
+        overflow_          = 0;
+        pointers_.storage  = celeritas::make_span(storage_);
+        pointers_.size     = &size_;
+        pointers_.overflow = &overflow_;
     }
 
     //! Access allocated data
@@ -45,12 +47,16 @@ class HostStackAllocatorStore
         return {storage_.data(), size_};
     }
 
+    //! Number of values that failed to allocate
+    size_type overflow() const { return overflow_; }
+
     //! Access host pointers
     const Pointers& host_pointers() const { return pointers_; }
 
   private:
     std::vector<value_type> storage_;
     size_type               size_;
+    size_type               overflow_;
     Pointers                pointers_;
 };
 
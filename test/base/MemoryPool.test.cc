@@ -0,0 +1,164 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MemoryPool.test.cc
+//---------------------------------------------------------------------------//
+#include "base/MemoryPool.hh"
+
+#include <cstdint>
+#include <memory>
+#include "base/DeviceAllocation.hh"
+#include "base/DeviceVector.hh"
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using celeritas::Byte;
+using celeritas::MemoryPool;
+using celeritas::MemSpace;
+using celeritas::size_type;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// Count calls to the underlying allocator
+int g_num_allocs = 0;
+int g_num_frees  = 0;
+
+Byte* counting_allocate(size_type bytes)
+{
+    ++g_num_allocs;
+    return new Byte[bytes];
+}
+
+void counting_free(Byte* ptr)
+{
+    ++g_num_frees;
+    delete[] ptr;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class MemoryPoolTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        g_num_allocs = 0;
+        g_num_frees  = 0;
+        pool = std::make_unique<MemoryPool>(counting_allocate, counting_free);
+    }
+
+    std::unique_ptr<MemoryPool> pool;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(MemoryPoolTest, block_size)
+{
+    EXPECT_EQ(256, MemoryPool::block_size(1));
+    EXPECT_EQ(256, MemoryPool::block_size(256));
+    EXPECT_EQ(320, MemoryPool::block_size(257));
+    EXPECT_EQ(512, MemoryPool::block_size(500));
+    EXPECT_EQ(640, MemoryPool::block_size(513));
+    EXPECT_EQ(1280, MemoryPool::block_size(1100));
+    EXPECT_EQ(1536, MemoryPool::block_size(1536));
+    EXPECT_EQ(1792, MemoryPool::block_size(1537));
+    EXPECT_EQ(5 * 1024 * 1024, MemoryPool::block_size(4 * 1024 * 1024 + 1));
+}
+
+TEST_F(MemoryPoolTest, recycle)
+{
+    // Steady-state "stepping": same-sized temporaries every step
+    for (CELER_MAYBE_UNUSED int step : celeritas::range(10))
+    {
+        Byte* a = pool->allocate(1000);
+        Byte* b = pool->allocate(100);
+        ASSERT_NE(nullptr, a);
+        ASSERT_NE(nullptr, b);
+        a[999] = Byte(1);
+        pool->deallocate(a, 1000);
+        // Similar size should reuse the freed block
+        Byte* c = pool->allocate(1010);
+        EXPECT_EQ(a, c);
+        pool->deallocate(b, 100);
+        pool->deallocate(c, 1010);
+    }
+    EXPECT_EQ(2, g_num_allocs);
+    EXPECT_EQ(0, g_num_frees);
+
+    auto stats = pool->stats();
+    EXPECT_EQ(30, stats.num_requests);
+    EXPECT_EQ(28, stats.num_reused);
+    EXPECT_EQ(2, stats.num_system_allocs);
+    EXPECT_EQ(0, stats.num_system_frees);
+    EXPECT_EQ(0, stats.bytes_in_use);
+    EXPECT_EQ(1024 + 256, stats.bytes_cached);
+    EXPECT_EQ(1024 + 256, stats.max_bytes_in_use);
+    EXPECT_EQ(1024 + 256, stats.max_bytes_reserved);
+
+    // Release the cache
+    EXPECT_EQ(1024 + 256, pool->trim());
+    EXPECT_EQ(2, g_num_frees);
+    stats = pool->stats();
+    EXPECT_EQ(0, stats.bytes_cached);
+    EXPECT_EQ(2, stats.num_system_frees);
+    EXPECT_EQ(0, pool->trim());
+
+    // Reset high-water marks
+    pool->reset_stats();
+    stats = pool->stats();
+    EXPECT_EQ(0, stats.num_requests);
+    EXPECT_EQ(0, stats.max_bytes_in_use);
+}
+
+TEST_F(MemoryPoolTest, high_water)
+{
+    Byte* a = pool->allocate(300);
+    Byte* b = pool->allocate(300);
+    pool->deallocate(a, 300);
+    EXPECT_EQ(640, pool->stats().max_bytes_in_use);
+    EXPECT_EQ(320, pool->stats().bytes_in_use);
+
+    // Different size class: new allocation
+    Byte* c = pool->allocate(2000);
+    EXPECT_EQ(3, g_num_allocs);
+    auto stats = pool->stats();
+    EXPECT_EQ(320 + 2048, stats.bytes_in_use);
+    EXPECT_EQ(320 + 2048, stats.max_bytes_in_use);
+    EXPECT_EQ(320 + 320 + 2048, stats.max_bytes_reserved);
+
+    pool->deallocate(b, 300);
+    pool->deallocate(c, 2000);
+
+    // Cached blocks are freed on destruction
+    pool.reset();
+    EXPECT_EQ(3, g_num_frees);
+}
+
+TEST_F(MemoryPoolTest, device_allocation)
+{
+    // Host allocations are recycled through the global host pool
+    MemoryPool& host_pool = celeritas::DeviceAllocation::pool(MemSpace::host);
+    host_pool.trim();
+    host_pool.reset_stats();
+
+    for (CELER_MAYBE_UNUSED int step : celeritas::range(5))
+    {
+        celeritas::DeviceVector<double> temp(100, MemSpace::host);
+        auto addr = reinterpret_cast<std::uintptr_t>(
+            temp.device_pointers().data());
+        EXPECT_EQ(0, addr % 64);
+    }
+    auto stats = host_pool.stats();
+    EXPECT_EQ(5, stats.num_requests);
+    EXPECT_EQ(1, stats.num_system_allocs);
+    EXPECT_EQ(896, stats.bytes_cached);
+    EXPECT_EQ(896, host_pool.trim());
+}
@@ -0,0 +1,215 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SlabAllocator.test.cc
+//---------------------------------------------------------------------------//
+#include "base/SlabAllocatorStore.hh"
+#include "base/SlabAllocatorView.hh"
+
+#include <algorithm>
+#include <vector>
+#include "base/StackAllocatorView.hh"
+#include "base/ThreadPool.hh"
+#include "base/SlabAllocatorStore.t.hh"
+#include "celeritas_test.hh"
+
+using celeritas::MemSpace;
+using celeritas::size_type;
+using celeritas::StackAllocatorView;
+
+namespace
+{
+struct MockHit
+{
+    int track = -1; //!< Default to garbage value
+};
+} // namespace
+
+// Explicitly instantiate mock slab allocator
+namespace celeritas
+{
+template class SlabAllocatorStore<MockHit>;
+}
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class SlabAllocatorTest : public celeritas::Test
+{
+  protected:
+    using SlabAllocatorStore = celeritas::SlabAllocatorStore<MockHit>;
+    using SlabAllocatorView  = celeritas::SlabAllocatorView<MockHit>;
+
+    //! Get the track IDs of all allocated (compacted) values
+    std::vector<int> get_tracks(SlabAllocatorStore& store)
+    {
+        auto             ptrs = store.device_pointers();
+        std::vector<int> result;
+        for (const MockHit& hit : StackAllocatorView<MockHit>(ptrs.items).get())
+        {
+            result.push_back(hit.track);
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SlabAllocatorTest, single)
+{
+    SlabAllocatorStore store(16, 4, 8, MemSpace::host);
+    EXPECT_EQ(16, store.capacity());
+    EXPECT_EQ(4, store.slab_size());
+    EXPECT_EQ(8, store.max_slabs());
+    EXPECT_EQ(0, store.get_size());
+
+    auto ptrs = store.device_pointers();
+    {
+        SlabAllocatorView allocate(ptrs);
+        EXPECT_EQ(16, allocate.capacity());
+        for (int i : celeritas::range(3))
+        {
+            MockHit* hit = allocate(1);
+            ASSERT_NE(nullptr, hit);
+            EXPECT_EQ(-1, hit->track);
+            hit->track = i;
+        }
+        // A single slab is reserved
+        EXPECT_EQ(4, store.get_size());
+    }
+    // The unused tail is returned when the view is destroyed
+    EXPECT_EQ(3, store.get_size());
+
+    EXPECT_EQ(3, store.compact());
+    const int expected_tracks[] = {0, 1, 2};
+    EXPECT_VEC_EQ(expected_tracks, get_tracks(store));
+
+    store.clear();
+    EXPECT_EQ(0, store.get_size());
+}
+
+TEST_F(SlabAllocatorTest, gaps)
+{
+    SlabAllocatorStore store(16, 4, 8, MemSpace::host);
+    auto               ptrs = store.device_pointers();
+
+    SlabAllocatorView alloc_a(ptrs);
+    SlabAllocatorView alloc_b(ptrs);
+    alloc_a(1)->track = 10;
+    alloc_b(1)->track = 20;
+    alloc_a(2)[1].track = 11;
+    alloc_b(3)[2].track = 21;
+    EXPECT_EQ(8, store.get_size());
+
+    // A larger request than the remaining slab reserves a new one
+    MockHit* hits = alloc_a(5);
+    ASSERT_NE(nullptr, hits);
+    hits[4].track = 12;
+    EXPECT_EQ(13, store.get_size());
+
+    // B's slab is not at the top of the stack so its tail can't be returned
+    alloc_b.release();
+    EXPECT_EQ(13, store.get_size());
+    alloc_a.release();
+    EXPECT_EQ(13, store.get_size());
+
+    EXPECT_EQ(12, store.compact());
+    const int expected_tracks[]
+        = {10, -1, 11, 20, -1, -1, 21, -1, -1, -1, -1, 12};
+    EXPECT_VEC_EQ(expected_tracks, get_tracks(store));
+    EXPECT_EQ(12, store.get_size());
+}
+
+TEST_F(SlabAllocatorTest, out_of_memory)
+{
+    SlabAllocatorStore store(10, 4, 8, MemSpace::host);
+    auto               ptrs = store.device_pointers();
+
+    SlabAllocatorView alloc_a(ptrs);
+    SlabAllocatorView alloc_b(ptrs);
+    ASSERT_NE(nullptr, alloc_a(3));
+    ASSERT_NE(nullptr, alloc_b(3));
+    EXPECT_EQ(8, store.get_size());
+
+    // A full slab no longer fits, but the exact request does
+    ASSERT_NE(nullptr, alloc_a(2));
+    EXPECT_EQ(10, store.get_size());
+    EXPECT_EQ(0, store.get_overflow());
+    EXPECT_EQ(nullptr, alloc_b(2));
+    EXPECT_EQ(nullptr, alloc_b(1));
+    EXPECT_EQ(10, store.get_size());
+    EXPECT_EQ(3, store.get_overflow());
+
+    alloc_a.release();
+    alloc_b.release();
+    EXPECT_EQ(8, store.compact());
+}
+
+TEST_F(SlabAllocatorTest, slab_overflow)
+{
+    SlabAllocatorStore store(100, 4, 2, MemSpace::host);
+    auto               ptrs = store.device_pointers();
+
+    SlabAllocatorView alloc_a(ptrs);
+    SlabAllocatorView alloc_b(ptrs);
+    SlabAllocatorView alloc_c(ptrs);
+    EXPECT_NE(nullptr, alloc_a(1));
+    EXPECT_NE(nullptr, alloc_b(1));
+
+    // No more slab records are available
+    EXPECT_EQ(nullptr, alloc_c(1));
+    EXPECT_NE(nullptr, alloc_a(3));
+    EXPECT_EQ(nullptr, alloc_a(1));
+
+    alloc_a.release();
+    alloc_b.release();
+    EXPECT_EQ(5, store.compact());
+    EXPECT_NE(nullptr, alloc_c(1));
+}
+
+TEST_F(SlabAllocatorTest, threaded)
+{
+    constexpr int      num_tracks = 1000;
+    SlabAllocatorStore store(2 * num_tracks, 16, 1000, MemSpace::host);
+    auto               ptrs = store.device_pointers();
+
+    celeritas::ThreadPool pool(4);
+    pool.parallel_for(num_tracks, 32, [&ptrs](size_type begin, size_type end) {
+        SlabAllocatorView allocate(ptrs);
+        for (auto i : celeritas::range(begin, end))
+        {
+            // Allocate a different number of hits per track
+            size_type num_hits = 1 + i % 3;
+            MockHit*  hits     = allocate(num_hits);
+            ASSERT_NE(nullptr, hits);
+            for (auto j : celeritas::range(num_hits))
+            {
+                hits[j].track = i;
+            }
+        }
+    });
+
+    size_type expected_size = 0;
+    for (auto i : celeritas::range(num_tracks))
+    {
+        expected_size += 1 + i % 3;
+    }
+    EXPECT_LE(expected_size, store.get_size());
+    EXPECT_EQ(expected_size, store.compact());
+
+    // Every track's hits should be present exactly once
+    auto tracks = get_tracks(store);
+    ASSERT_EQ(expected_size, tracks.size());
+    std::sort(tracks.begin(), tracks.end());
+    std::vector<int> expected_tracks;
+    for (auto i : celeritas::range(num_tracks))
+    {
+        expected_tracks.insert(expected_tracks.end(), 1 + i % 3, i);
+    }
+    EXPECT_VEC_EQ(expected_tracks, tracks);
+}
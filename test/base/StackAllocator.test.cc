@@ -54,9 +54,11 @@ TEST_F(StackAllocatorHostTest, allocation)
     }
 
     // Ask for one more than we have room
+    EXPECT_EQ(0, secondaries_.overflow());
     ptr = alloc(9);
     EXPECT_EQ(nullptr, ptr);
     EXPECT_EQ(8, alloc.get().size());
+    EXPECT_EQ(9, secondaries_.overflow());
 
     // Ask for an amount that barely fits
     ptr = alloc(8);
@@ -65,6 +67,77 @@ TEST_F(StackAllocatorHostTest, allocation)
     EXPECT_EQ(16, const_cast<const StackAllocatorView&>(alloc).get().size());
 }
 
+#if !CELERITAS_USE_CUDA
+TEST_F(StackAllocatorHostTest, store)
+{
+    // Without CUDA, the store allocates host memory
+    celeritas::StackAllocatorStore<MockSecondary> store(16);
+    EXPECT_EQ(0, store.get_size());
+
+    auto               ptrs = store.device_pointers();
+    StackAllocatorView alloc(ptrs);
+    ASSERT_NE(nullptr, alloc(10));
+    EXPECT_EQ(10, store.get_size());
+    EXPECT_EQ(nullptr, alloc(10));
+    EXPECT_EQ(10, store.get_size());
+
+    store.clear();
+    EXPECT_EQ(0, store.get_size());
+}
+#endif
+
+TEST_F(StackAllocatorHostTest, overflow)
+{
+    celeritas::StackAllocatorStore<MockSecondary> store(
+        8, 24, celeritas::MemSpace::host);
+    EXPECT_EQ(8, store.capacity());
+    EXPECT_EQ(32, store.max_capacity());
+    EXPECT_EQ(0, store.get_overflow());
+
+    // Nothing to do if no allocation failed
+    EXPECT_TRUE(store.grow());
+    EXPECT_EQ(8, store.capacity());
+
+    // Run out of memory
+    auto           ptrs  = store.device_pointers();
+    MockSecondary* first = nullptr;
+    {
+        StackAllocatorView alloc(ptrs);
+        first = alloc(6);
+        ASSERT_NE(nullptr, first);
+        first->def_id = 1234;
+        EXPECT_EQ(nullptr, alloc(4));
+        EXPECT_NE(nullptr, alloc(2));
+    }
+    EXPECT_EQ(8, store.get_size());
+    EXPECT_EQ(4, store.get_overflow());
+
+    // Grow into the overflow arena without moving existing data
+    EXPECT_TRUE(store.grow());
+    EXPECT_EQ(16, store.capacity());
+    EXPECT_EQ(0, store.get_overflow());
+    EXPECT_EQ(8, store.get_size());
+    ptrs = store.device_pointers();
+    EXPECT_EQ(first, ptrs.storage.data());
+    EXPECT_EQ(1234, ptrs.storage.front().def_id);
+    {
+        StackAllocatorView alloc(ptrs);
+        EXPECT_NE(nullptr, alloc(4));
+        EXPECT_EQ(nullptr, alloc(30));
+    }
+    EXPECT_EQ(12, store.get_size());
+    EXPECT_EQ(30, store.get_overflow());
+
+    // Arena is too small
+    EXPECT_FALSE(store.grow());
+    EXPECT_EQ(32, store.capacity());
+
+    store.clear();
+    EXPECT_EQ(0, store.get_size());
+    EXPECT_EQ(0, store.get_overflow());
+    EXPECT_EQ(32, store.capacity());
+}
+
 //---------------------------------------------------------------------------//
 // DEVICE TESTS
 //---------------------------------------------------------------------------//
@@ -0,0 +1,142 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StateCollection.test.cc
+//---------------------------------------------------------------------------//
+#include "base/StateCollection.hh"
+
+#include <cstdint>
+#include "base/Range.hh"
+#include "base/StateCollectionStore.t.hh"
+#include "celeritas_test.hh"
+
+using celeritas::MemSpace;
+using celeritas::size_type;
+using celeritas::StateCollection;
+using celeritas::StateCollectionStore;
+using celeritas::ThreadId;
+namespace layout = celeritas::layout;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+struct Fields
+{
+    enum : size_type
+    {
+        id,
+        energy,
+        alive
+    };
+};
+
+template<size_type I, class P>
+std::uintptr_t address(const P& states, size_type i)
+{
+    return reinterpret_cast<std::uintptr_t>(
+        &states.template get<I>(ThreadId(i)));
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+template<class L>
+class StateCollectionTest : public celeritas::Test
+{
+  protected:
+    using Collection = StateCollection<L, int, double, bool>;
+    using Store      = StateCollectionStore<Collection>;
+};
+
+using Layouts
+    = ::testing::Types<layout::AoS, layout::SoA, layout::AoSoA<8>>;
+TYPED_TEST_SUITE(StateCollectionTest, Layouts);
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(StateCollectionTest, default)
+{
+    typename TestFixture::Collection states;
+    EXPECT_FALSE(states);
+    EXPECT_TRUE(states.empty());
+    EXPECT_EQ(0, states.size());
+    EXPECT_EQ(3, states.num_fields());
+}
+
+TYPED_TEST(StateCollectionTest, fields)
+{
+    typename TestFixture::Store store(37, MemSpace::host);
+    EXPECT_EQ(37, store.size());
+    EXPECT_EQ(MemSpace::host, store.memspace());
+    EXPECT_LE(37 * (sizeof(int) + sizeof(double) + sizeof(bool)),
+              store.num_bytes());
+
+    auto states = store.device_pointers();
+    EXPECT_TRUE(states);
+    ASSERT_EQ(37, states.size());
+
+    for (auto i : celeritas::range(states.size()))
+    {
+        states.template get<Fields::id>(ThreadId(i))     = 2 * i;
+        states.template get<Fields::energy>(ThreadId(i)) = 0.5 * i;
+        states.template get<Fields::alive>(ThreadId(i))  = (i % 3 == 0);
+    }
+    for (auto i : celeritas::range(states.size()))
+    {
+        EXPECT_EQ(2 * i, states.template get<Fields::id>(ThreadId(i)));
+        EXPECT_EQ(0.5 * i, states.template get<Fields::energy>(ThreadId(i)));
+        EXPECT_EQ(i % 3 == 0, states.template get<Fields::alive>(ThreadId(i)));
+    }
+}
+
+TEST(StateCollectionLayoutTest, aos)
+{
+    using Collection = StateCollection<layout::AoS, int, double>;
+    StateCollectionStore<Collection> store(4, MemSpace::host);
+    auto                             states = store.device_pointers();
+
+    // Fields of a single track are adjacent
+    EXPECT_EQ(address<0>(states, 0) + sizeof(double),
+              address<1>(states, 0));
+    EXPECT_EQ(address<0>(states, 0) + 2 * sizeof(double),
+              address<0>(states, 1));
+}
+
+TEST(StateCollectionLayoutTest, soa)
+{
+    using Collection = StateCollection<layout::SoA, int, double>;
+    StateCollectionStore<Collection> store(4, MemSpace::host);
+    auto                             states = store.device_pointers();
+
+    // Consecutive tracks are adjacent, and field arrays are aligned
+    EXPECT_EQ(address<0>(states, 0) + sizeof(int),
+              address<0>(states, 1));
+    EXPECT_EQ(address<1>(states, 0) + sizeof(double),
+              address<1>(states, 1));
+    EXPECT_EQ(0, address<0>(states, 0) % 64);
+    EXPECT_EQ(0, address<1>(states, 0) % 64);
+    EXPECT_EQ(128, store.num_bytes());
+}
+
+TEST(StateCollectionLayoutTest, aosoa)
+{
+    using Collection = StateCollection<layout::AoSoA<4>, int, double>;
+    StateCollectionStore<Collection> store(6, MemSpace::host);
+    auto                             states = store.device_pointers();
+
+    // Tracks within a block are adjacent; blocks hold all fields
+    EXPECT_EQ(address<0>(states, 0) + sizeof(int),
+              address<0>(states, 1));
+    EXPECT_EQ(address<0>(states, 0) + 4 * sizeof(int),
+              address<1>(states, 0));
+    EXPECT_EQ(address<0>(states, 0) + 4 * sizeof(int)
+                  + 4 * sizeof(double),
+              address<0>(states, 4));
+    EXPECT_EQ(2 * (4 * sizeof(int) + 4 * sizeof(double)), store.num_bytes());
+}
@@ -0,0 +1,265 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TimerRegistry.test.cc
+//---------------------------------------------------------------------------//
+#include "base/TimerRegistry.hh"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "base/ScopedDeviceTimer.hh"
+#include "base/ScopedTimer.hh"
+#include "celeritas_test.hh"
+
+using celeritas::ScopedDeviceTimer;
+using celeritas::ScopedTimer;
+using celeritas::TimerRegistry;
+using celeritas::TimerTree;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+const TimerTree* find_child(const TimerTree& tree, const std::string& name)
+{
+    for (const TimerTree& child : tree.children)
+    {
+        if (child.name == name)
+            return &child;
+    }
+    return nullptr;
+}
+
+void do_step(TimerRegistry& registry)
+{
+    ScopedTimer time_step("step", registry);
+    for (int i = 0; i < 3; ++i)
+    {
+        ScopedTimer time_interact("interact", registry);
+    }
+    ScopedTimer time_tally("tally", registry);
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(TimerRegistryTest, nesting)
+{
+    TimerRegistry registry;
+    {
+        ScopedTimer time_init("initialize", registry);
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        do_step(registry);
+    }
+
+    TimerTree result = registry.merged();
+    EXPECT_EQ("", result.name);
+    ASSERT_EQ(2, result.children.size());
+    EXPECT_EQ("initialize", result.children[0].name);
+    EXPECT_EQ(1, result.children[0].count);
+
+    const TimerTree* step = find_child(result, "step");
+    ASSERT_TRUE(step);
+    EXPECT_EQ(4, step->count);
+    EXPECT_EQ(1, step->num_threads);
+    EXPECT_GE(step->time, 0);
+    EXPECT_EQ(step->time, step->max_time);
+    ASSERT_EQ(2, step->children.size());
+
+    const TimerTree* interact = find_child(*step, "interact");
+    ASSERT_TRUE(interact);
+    EXPECT_EQ(12, interact->count);
+    EXPECT_LE(interact->time, step->time);
+    const TimerTree* tally = find_child(*step, "tally");
+    ASSERT_TRUE(tally);
+    EXPECT_EQ(4, tally->count);
+
+    // Same name in a different scope is a different node
+    {
+        ScopedTimer time_tally("tally", registry);
+    }
+    result = registry.merged();
+    EXPECT_EQ(3, result.children.size());
+    EXPECT_EQ(1, find_child(result, "tally")->count);
+
+    // Reset clears counts but not structure
+    registry.reset();
+    result = registry.merged();
+    EXPECT_EQ(3, result.children.size());
+    EXPECT_EQ(0, find_child(result, "step")->count);
+    EXPECT_EQ(0, result.time);
+}
+
+TEST(TimerRegistryTest, disabled)
+{
+    TimerRegistry registry;
+    registry.enabled(false);
+    do_step(registry);
+    EXPECT_TRUE(registry.merged().children.empty());
+
+    registry.enabled(true);
+    do_step(registry);
+    EXPECT_EQ(1, registry.merged().children.size());
+}
+
+TEST(TimerRegistryTest, multithread)
+{
+    TimerRegistry registry;
+    constexpr int num_threads = 4;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&registry, t] {
+            for (int i = 0; i <= t; ++i)
+            {
+                do_step(registry);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    TimerTree        result = registry.merged();
+    const TimerTree* step   = find_child(result, "step");
+    ASSERT_TRUE(step);
+    EXPECT_EQ(1 + 2 + 3 + 4, step->count);
+    EXPECT_EQ(num_threads, step->num_threads);
+    EXPECT_LE(step->max_time, step->time);
+    EXPECT_EQ(3 * step->count, find_child(*step, "interact")->count);
+}
+
+TEST(TimerRegistryTest, alternating)
+{
+    // Switching between registries on one thread reuses each thread's tree
+    TimerRegistry a;
+    TimerRegistry b;
+    TimerRegistry::ThreadTree* tree_a = &a.thread_tree();
+    for (int i = 0; i < 5; ++i)
+    {
+        do_step(a);
+        do_step(b);
+    }
+    EXPECT_EQ(tree_a, &a.thread_tree());
+
+    for (const TimerRegistry* registry : {&a, &b})
+    {
+        TimerTree        result = registry->merged();
+        const TimerTree* step   = find_child(result, "step");
+        ASSERT_TRUE(step);
+        EXPECT_EQ(5, step->count);
+        EXPECT_EQ(1, step->num_threads);
+    }
+}
+
+TEST(TimerRegistryTest, device)
+{
+    // Device times are read when merging (host times without CUDA)
+    TimerRegistry registry;
+    for (int i = 0; i < 3; ++i)
+    {
+        ScopedTimer time_step("step", registry);
+        ScopedDeviceTimer time_kernel("kernel", registry);
+    }
+    {
+        ScopedDeviceTimer time_kernel("kernel", registry);
+    }
+
+    TimerTree        result = registry.merged();
+    const TimerTree* step   = find_child(result, "step");
+    ASSERT_TRUE(step);
+    EXPECT_EQ(3, step->count);
+    const TimerTree* nested = find_child(*step, "kernel");
+    ASSERT_TRUE(nested);
+    EXPECT_EQ(3, nested->count);
+    EXPECT_GE(nested->time, 0);
+    const TimerTree* kernel = find_child(result, "kernel");
+    ASSERT_TRUE(kernel);
+    EXPECT_EQ(1, kernel->count);
+
+    // Merging again gives the same results
+    EXPECT_EQ(nested->time, find_child(*find_child(registry.merged(), "step"),
+                                       "kernel")
+                                ->time);
+
+    registry.reset();
+    EXPECT_EQ(0, find_child(registry.merged(), "kernel")->count);
+}
+
+TEST(TimerRegistryTest, device_reuse)
+{
+    // Events are returned to their node once their time has been read
+    TimerRegistry registry;
+    {
+        ScopedDeviceTimer time_kernel("kernel", registry);
+    }
+    registry.merged();
+
+    TimerRegistry::ThreadTree& tree = registry.thread_tree();
+    TimerRegistry::NodeId      node = TimerRegistry::push(tree, "kernel");
+    auto reused = TimerRegistry::acquire_events(tree, node);
+    EXPECT_TRUE(reused);
+    auto created = TimerRegistry::acquire_events(tree, node);
+    EXPECT_FALSE(created);
+    TimerRegistry::pop(tree, node, 0);
+}
+
+TEST(TimerRegistryTest, concurrent_merge)
+{
+    // Results can be merged while another thread is timing
+    TimerRegistry     registry;
+    std::atomic<bool> done{false};
+    std::thread       worker([&registry, &done] {
+        for (int i = 0; i < 1000; ++i)
+        {
+            do_step(registry);
+            ScopedDeviceTimer time_kernel("kernel", registry);
+        }
+        done = true;
+    });
+    while (!done)
+    {
+        TimerTree        result = registry.merged();
+        const TimerTree* step   = find_child(result, "step");
+        if (step)
+        {
+            EXPECT_LE(step->count, 1000);
+        }
+    }
+    worker.join();
+
+    TimerTree result = registry.merged();
+    EXPECT_EQ(1000, find_child(result, "step")->count);
+    EXPECT_EQ(1000, find_child(result, "kernel")->count);
+}
+
+TEST(TimerRegistryTest, json)
+{
+    TimerTree tree;
+    tree.children.push_back({});
+    tree.children[0].name  = "a \"quoted\" name";
+    tree.children[0].count = 2;
+    tree.children[0].time  = 0.5;
+    tree.children.push_back({});
+    tree.children[1].name = "b\n\x01";
+
+    std::ostringstream os;
+    celeritas::write_json(os, tree);
+    EXPECT_EQ(
+        R"({"name":"","count":0,"time":0,"max_time":0,"num_threads":0,)"
+        R"("children":[{"name":"a \"quoted\" name","count":2,"time":0.5,)"
+        R"("max_time":0,"num_threads":0,"children":[]},)"
+        R"({"name":"b\u000a\u0001","count":0,"time":0,"max_time":0,)"
+        R"("num_threads":0,)"
+        R"("children":[]}]})",
+        os.str());
+}
@@ -228,7 +228,7 @@ TEST_F(RootImporterTest, import_material_params)
      * Celeritas constants results in the slightly different numerical values
      * calculated by Celeritas.
      */
-    auto material = mat_host_ptr.materials[1];
+    auto material = mat_host_ptr.materials[MaterialDefId{1}];
 
     EXPECT_EQ(MatterState::solid, material.matter_state);
     EXPECT_SOFT_EQ(293.15, material.temperature);         // [K]
@@ -246,9 +246,10 @@ TEST_F(RootImporterTest, import_material_params)
         = {ElementDefId{0}, ElementDefId{1}, ElementDefId{2}};
     real_type fraction[array_size] = {0.74, 0.18, 0.08};
 
-    for (auto i : celeritas::range(material.elements.size()))
+    auto elements = mat_host_ptr.elcomponents[material.elements];
+    for (auto i : celeritas::range(elements.size()))
     {
-        EXPECT_EQ(material.elements[i].element, element_def_id[i]);
-        EXPECT_SOFT_EQ(material.elements[i].fraction, fraction[i]);
+        EXPECT_EQ(elements[i].element, element_def_id[i]);
+        EXPECT_SOFT_EQ(elements[i].fraction, fraction[i]);
     }
 }
@@ -27,7 +27,7 @@ InteractorHostTestBase::InteractorHostTestBase()
 {
     this->resize_secondaries(128);
     ms_pointers_.state = {&mat_state_, 1};
-    ps_pointers_.vars  = {&particle_state_, 1};
+    ps_pointers_       = particle_state_.device_pointers();
 }
 
 //---------------------------------------------------------------------------//
@@ -104,11 +104,9 @@ void InteractorHostTestBase::set_inc_particle(PDGNumber pdg, MevEnergy energy)
     CELER_EXPECT(pdg);
     CELER_EXPECT(energy >= zero_quantity());
 
-    particle_state_.def_id = particle_params_->find(pdg);
-    particle_state_.energy = energy;
-
     pt_view_ = std::make_shared<ParticleTrackView>(
         pp_pointers_, ps_pointers_, ThreadId{0});
+    *pt_view_ = {particle_params_->find(pdg), energy};
 }
 
 //---------------------------------------------------------------------------//
@@ -152,9 +150,8 @@ void InteractorHostTestBase::check_conservation(const Interaction& interaction)
 void InteractorHostTestBase::check_energy_conservation(
     const Interaction& interaction) const
 {
-    ParticleTrackState    local_state = particle_state_;
-    ParticleStatePointers local_state_ptrs;
-    local_state_ptrs.vars = {&local_state, 1};
+    ParticleStateStore    local_state(1, MemSpace::host);
+    ParticleStatePointers local_state_ptrs = local_state.device_pointers();
 
     // Sum of exiting kinetic energy
     real_type exit_energy = interaction.energy_deposition.value();
@@ -162,20 +159,18 @@ void InteractorHostTestBase::check_energy_conservation(
     // Subtract contribution from exiting particle state
     if (interaction && !action_killed(interaction.action))
     {
-        local_state.def_id = particle_state_.def_id;
-        local_state.energy = interaction.energy;
         ParticleTrackView exiting_track(
             pp_pointers_, local_state_ptrs, ThreadId{0});
+        exiting_track = {this->particle_track().def_id(), interaction.energy};
         exit_energy += exiting_track.energy().value();
     }
 
     // Subtract contributions from exiting secondaries
     for (const Secondary& s : interaction.secondaries)
     {
-        local_state.def_id = s.def_id;
-        local_state.energy = s.energy;
         ParticleTrackView secondary_track(
             pp_pointers_, local_state_ptrs, ThreadId{0});
+        secondary_track = {s.def_id, s.energy};
         exit_energy += secondary_track.energy().value();
     }
 
@@ -193,9 +188,8 @@ void InteractorHostTestBase::check_energy_conservation(
 void InteractorHostTestBase::check_momentum_conservation(
     const Interaction& interaction) const
 {
-    ParticleTrackState    local_state = particle_state_;
-    ParticleStatePointers local_state_ptrs;
-    local_state_ptrs.vars = {&local_state, 1};
+    ParticleStateStore    local_state(1, MemSpace::host);
+    ParticleStatePointers local_state_ptrs = local_state.device_pointers();
 
     // Sum of exiting momentum
     Real3 exit_momentum = {0, 0, 0};
@@ -203,10 +197,9 @@ void InteractorHostTestBase::check_momentum_conservation(
     // Subtract contribution from exiting particle state
     if (interaction && !action_killed(interaction.action))
     {
-        local_state.def_id = particle_state_.def_id;
-        local_state.energy = interaction.energy;
         ParticleTrackView exiting_track(
             pp_pointers_, local_state_ptrs, ThreadId{0});
+        exiting_track = {this->particle_track().def_id(), interaction.energy};
         axpy(exiting_track.momentum().value(),
              interaction.direction,
              &exit_momentum);
@@ -215,10 +208,9 @@ void InteractorHostTestBase::check_momentum_conservation(
     // Subtract contributions from exiting secondaries
     for (const Secondary& s : interaction.secondaries)
     {
-        local_state.def_id = s.def_id;
-        local_state.energy = s.energy;
         ParticleTrackView secondary_track(
             pp_pointers_, local_state_ptrs, ThreadId{0});
+        secondary_track = {s.def_id, s.energy};
         axpy(secondary_track.momentum().value(), s.direction, &exit_momentum);
     }
 
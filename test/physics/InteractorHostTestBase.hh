@@ -18,6 +18,7 @@
 #include "physics/base/ModelIdGenerator.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/ParticleStatePointers.hh"
+#include "physics/base/ParticleStateStore.hh"
 #include "physics/base/Secondary.hh"
 #include "physics/base/Units.hh"
 #include "physics/material/MaterialParams.hh"
@@ -157,7 +158,8 @@ class InteractorHostTestBase : public celeritas::Test
     celeritas::MaterialParamsPointers mp_pointers_;
     celeritas::MaterialStatePointers  ms_pointers_;
 
-    celeritas::ParticleTrackState     particle_state_;
+    celeritas::ParticleStateStore     particle_state_{1,
+                                                  celeritas::MemSpace::host};
     celeritas::ParticleParamsPointers pp_pointers_;
     celeritas::ParticleStatePointers  ps_pointers_;
     Real3                             inc_direction_ = {0, 0, 1};
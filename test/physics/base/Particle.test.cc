@@ -100,11 +100,11 @@ class ParticleTrackViewTestHost : public ParticleTrackViewTest
         CELER_ASSERT(particle_params);
 
         // Construct views
-        params_view     = particle_params->host_pointers();
-        state_view.vars = celeritas::make_span(state_storage);
+        params_view = particle_params->host_pointers();
+        state_view  = state_storage.device_pointers();
     }
 
-    celeritas::Array<celeritas::ParticleTrackState, 1> state_storage;
+    ParticleStateStore state_storage{1, celeritas::MemSpace::host};
 
     ParticleParamsPointers params_view;
     ParticleStatePointers  state_view;
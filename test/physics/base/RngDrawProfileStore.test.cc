@@ -0,0 +1,149 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngDrawProfileStore.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/RngDrawProfileStore.hh"
+
+#include <sstream>
+#include <thread>
+#include "comm/Device.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/RngDrawProfiler.hh"
+#include "celeritas_test.hh"
+
+using celeritas::MemSpace;
+using celeritas::ModelId;
+using celeritas::ModelInteractPointers;
+using celeritas::RngDrawHistogram;
+using celeritas::RngDrawProfilePointers;
+using celeritas::RngDrawProfiler;
+using celeritas::RngDrawProfileStore;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(RngDrawProfileStoreTest, disabled)
+{
+    // Recording without storage is a no-op
+    RngDrawProfilePointers ptrs;
+    EXPECT_FALSE(ptrs);
+    RngDrawProfiler        record(ptrs);
+    record(ModelId{0}, 3);
+}
+
+TEST(RngDrawProfileStoreTest, host)
+{
+    RngDrawProfileStore profile(2, 4, MemSpace::host);
+    EXPECT_EQ(2, profile.num_models());
+    EXPECT_EQ(4, profile.num_bins());
+
+    auto            ptrs = profile.device_pointers();
+    RngDrawProfiler record(ptrs);
+    record(ModelId{1}, 2);
+    record(ModelId{1}, 2);
+    record(ModelId{1}, 3);
+    record(ModelId{1}, 10);
+    record(ModelId{0}, 0);
+
+    RngDrawHistogram hist = profile.histogram(ModelId{1});
+    const unsigned long long expected_counts[] = {0, 0, 2, 2};
+    EXPECT_VEC_EQ(expected_counts, hist.counts);
+    EXPECT_EQ(4, hist.num_calls());
+    EXPECT_EQ(17, hist.total_draws);
+    EXPECT_SOFT_EQ(4.25, hist.mean());
+
+    std::ostringstream os;
+    write_json(os, profile);
+    EXPECT_EQ(
+        "[{\"model\":0,\"num_calls\":1,\"total_draws\":0,\"mean\":0,"
+        "\"counts\":[1,0,0,0]},"
+        "{\"model\":1,\"num_calls\":4,\"total_draws\":17,\"mean\":4.25,"
+        "\"counts\":[0,0,2,2]}]",
+        os.str());
+
+    profile.clear();
+    EXPECT_EQ(0, profile.histogram(ModelId{1}).num_calls());
+    EXPECT_EQ(0, profile.histogram(ModelId{1}).mean());
+}
+
+TEST(RngDrawProfileStoreTest, resize)
+{
+    RngDrawProfileStore profile(1, 3, MemSpace::host);
+    auto                ptrs = profile.device_pointers();
+    RngDrawProfiler     record_first(ptrs);
+    record_first(ModelId{0}, 1);
+
+    profile.resize(3);
+    EXPECT_EQ(3, profile.num_models());
+    auto            resized_ptrs = profile.device_pointers();
+    RngDrawProfiler record_last(resized_ptrs);
+    record_last(ModelId{2}, 5);
+
+    const unsigned long long expected_first[] = {0, 1, 0};
+    EXPECT_VEC_EQ(expected_first, profile.histogram(ModelId{0}).counts);
+    EXPECT_EQ(0, profile.histogram(ModelId{1}).num_calls());
+    const unsigned long long expected_last[] = {0, 0, 1};
+    EXPECT_VEC_EQ(expected_last, profile.histogram(ModelId{2}).counts);
+    EXPECT_EQ(5, profile.histogram(ModelId{2}).total_draws);
+
+    // Shrinking is a no-op
+    profile.resize(2);
+    EXPECT_EQ(3, profile.num_models());
+}
+
+TEST(RngDrawProfileStoreTest, add_rng_profile)
+{
+    // Caller-provided pointers are kept
+    RngDrawProfileStore   profile(1, 2, MemSpace::host);
+    ModelInteractPointers pointers;
+    pointers.rng_profile = profile.device_pointers();
+    auto kept = celeritas::add_rng_profile(ModelId{3}, pointers);
+    EXPECT_EQ(pointers.rng_profile.counts.data(),
+              kept.rng_profile.counts.data());
+    EXPECT_EQ(1, profile.num_models());
+
+    auto result = celeritas::add_rng_profile(ModelId{3}, {});
+    if (!CELERITAS_PROFILE_RNG)
+    {
+        EXPECT_FALSE(result.rng_profile);
+        return;
+    }
+
+    // Models without profile pointers record into the global store
+    auto& global = RngDrawProfileStore::global();
+    ASSERT_TRUE(result.rng_profile);
+    EXPECT_LE(4, global.num_models());
+    if (celeritas::is_device_enabled())
+    {
+        SKIP("global profile is in device memory");
+    }
+    global.clear();
+    RngDrawProfiler record(result.rng_profile);
+    record(ModelId{3}, 2);
+    record(ModelId{3}, 4);
+    RngDrawHistogram hist = global.histogram(ModelId{3});
+    EXPECT_EQ(2, hist.num_calls());
+    EXPECT_EQ(6, hist.total_draws);
+
+    // The global store can only be used from a single thread
+    if (CELERITAS_DEBUG)
+    {
+        bool        threw = false;
+        std::thread other([&threw] {
+            try
+            {
+                celeritas::add_rng_profile(ModelId{0}, {});
+            }
+            catch (const celeritas::DebugError&)
+            {
+                threw = true;
+            }
+        });
+        other.join();
+        EXPECT_TRUE(threw);
+    }
+}
@@ -125,13 +125,13 @@ TEST_F(KleinNishinaInteractorTest, ten_mev)
 
     // Note: these are "gold" values based on the host RNG.
     const double expected_energy[]
-        = {0.4581502636229, 1.325852509857, 9.837250571445, 0.5250297816972};
+        = {0.4581502636229, 4.987890560161, 9.82492770001, 0.5253734934944};
     const double expected_costheta[] = {
-        -0.0642523962721, 0.6656882878883, 0.9991545931877, 0.07782377978055};
+        -0.0642523962721, 0.9486519880378, 0.9990894410268, 0.07846052009343};
     const double expected_energy_electron[]
-        = {9.541849736377, 8.674147490143, 0.1627494285554, 9.474970218303};
+        = {9.541849736377, 5.012109439839, 0.1750722999896, 9.474626506506};
     const double expected_costheta_electron[]
-        = {0.998962567429, 0.9941635460938, 0.3895748042313, 0.9986216572142};
+        = {0.998962567429, 0.9579608258282, 0.4019693159802, 0.9986198936621};
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_costheta, costheta);
     EXPECT_VEC_SOFT_EQ(expected_energy_electron, energy_electron);
@@ -192,7 +192,7 @@ TEST_F(KleinNishinaInteractorTest, stress_test)
     // PRINT_EXPECTED(avg_engine_samples);
     // Gold values for average number of calls to RNG
     const double expected_avg_engine_samples[]
-        = {10.99816894531, 9.483154296875, 8.295532226562, 8.00439453125};
+        = {14.11657714844, 12.6025390625, 11.37213134766, 11.10632324219};
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
@@ -241,9 +241,9 @@ TEST_F(KleinNishinaInteractorTest, distributions)
     // PRINT_EXPECTED(eps_dist);
     // PRINT_EXPECTED(costheta_dist);
     const int expected_eps_dist[]
-        = {0, 0, 2010, 1365, 1125, 1067, 1077, 1066, 1123, 1167};
+        = {0, 0, 2155, 1315, 1092, 996, 1081, 1085, 1109, 1167};
     const int expected_costheta_dist[]
-        = {495, 459, 512, 528, 565, 701, 803, 1101, 1693, 3143};
+        = {537, 502, 571, 525, 567, 661, 771, 1029, 1678, 3159};
     EXPECT_VEC_EQ(expected_eps_dist, eps_dist);
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
 }
@@ -168,11 +168,11 @@ TEST_F(LivermorePEInteractorTest, basic)
 
     // Note: these are "gold" values based on the host RNG.
     const double expected_energy_electron[]
-        = {0.00062884, 0.00062884, 0.00070136, 0.00069835};
+        = {0.00062884, 0.00097653, 0.00070136, 0.00070136};
     const double expected_costheta_electron[] = {
-        0.1217302869581, 0.8769397871407, -0.1414717733267, -0.2414106440617};
+        0.1217302869581, -0.0276943439838, -0.1414717733267, 0.2261803972977};
     const double expected_energy_deposition[]
-        = {0.00037116, 0.00037116, 0.00029864, 0.00030165};
+        = {0.00037116, 2.347e-05, 0.00029864, 0.00029864};
     EXPECT_VEC_SOFT_EQ(expected_energy_electron, energy_electron);
     EXPECT_VEC_SOFT_EQ(expected_costheta_electron, costheta_electron);
     EXPECT_VEC_SOFT_EQ(expected_energy_deposition, energy_deposition);
@@ -233,7 +233,7 @@ TEST_F(LivermorePEInteractorTest, stress_test)
     // PRINT_EXPECTED(avg_engine_samples);
     // Gold values for average number of calls to RNG
     const double expected_avg_engine_samples[]
-        = {15.99755859375, 16.09204101562, 13.79919433594, 8.590209960938, 2};
+        = {19.0908203125, 19.10900878906, 16.94311523438, 11.67614746094, 2};
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MockXsCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/em/MockXsCalculator.hh"
+
+#include <cmath>
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "physics/grid/SplineDerivCalculator.hh"
+#include "celeritas_test.hh"
+
+using celeritas::make_builder;
+using celeritas::make_span;
+using celeritas::SplineDerivCalculator;
+using celeritas::ValueGrid;
+using celeritas::XsCalculator;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class MockXsCalculatorTest : public celeritas::Test
+{
+  protected:
+    using real_type = celeritas::real_type;
+    using VecReal   = std::vector<real_type>;
+
+    void SetUp() override
+    {
+        // Cubic function on a nonuniform grid
+        energy = {1, 1.5, 2.5, 4, 7, 10};
+        for (real_type e : energy)
+        {
+            xs.push_back(this->func(e));
+        }
+    }
+
+    static real_type func(real_type e) { return e * e * e - 8 * e * e + 100; }
+
+    // Build a grid from the stored data
+    ValueGrid build(const VecReal& deriv2)
+    {
+        auto      build_reals = make_builder(&reals);
+        ValueGrid result;
+        result.energy = build_reals.insert_back(energy.begin(), energy.end());
+        result.xs     = build_reals.insert_back(xs.begin(), xs.end());
+        result.deriv2 = build_reals.insert_back(deriv2.begin(), deriv2.end());
+        return result;
+    }
+
+    VecReal energy;
+    VecReal xs;
+    VecReal reals;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(MockXsCalculatorTest, linear)
+{
+    ValueGrid            grid = this->build({});
+    XsCalculator::Values values(make_span(reals));
+    XsCalculator         calc_xs(grid, values);
+
+    // Exact on grid points and snapped outside the grid
+    EXPECT_SOFT_EQ(xs[2], calc_xs(2.5));
+    EXPECT_SOFT_EQ(xs.front(), calc_xs(0.5));
+    EXPECT_SOFT_EQ(xs.back(), calc_xs(20));
+
+    // Linear between grid points
+    EXPECT_SOFT_EQ((xs[3] + xs[4]) / 2, calc_xs(5.5));
+}
+
+TEST_F(MockXsCalculatorTest, spline)
+{
+    VecReal deriv2 = SplineDerivCalculator(
+        SplineDerivCalculator::BoundaryCondition::not_a_knot)(
+        make_span(energy), make_span(xs));
+    ValueGrid            grid = this->build(deriv2);
+    XsCalculator::Values values(make_span(reals));
+    XsCalculator         calc_xs(grid, values);
+
+    // Exact on grid points and snapped outside the grid
+    EXPECT_SOFT_EQ(xs[2], calc_xs(2.5));
+    EXPECT_SOFT_EQ(xs.front(), calc_xs(0.5));
+    EXPECT_SOFT_EQ(xs.back(), calc_xs(20));
+
+    // Not-a-knot spline reproduces a cubic exactly between grid points
+    for (real_type e : {1.2, 2.0, 3.3, 5.5, 8.9})
+    {
+        EXPECT_SOFT_EQ(func(e), calc_xs(e));
+    }
+    EXPECT_GT(std::fabs((xs[3] + xs[4]) / 2 - calc_xs(5.5)), 1);
+}
@@ -0,0 +1,56 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CalculatorTestBase.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "celeritas_config.h"
+#include "base/Quantity.hh"
+#include "base/Span.hh"
+#include "physics/grid/XsGridPointers.hh"
+#include "gtest/Test.hh"
+
+namespace celeritas_test
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Test harness base class for interpolating log-spaced physics tables.
+ *
+ * The tables have four grid points at 0.1, 1, 10, and 100 MeV.
+ */
+class CalculatorTestBase : public celeritas::Test
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = celeritas::real_type;
+    using EnergyUnits = celeritas::XsGridPointers::EnergyUnits;
+    using Energy      = celeritas::Quantity<EnergyUnits>;
+    using VecReal     = std::vector<celeritas::grid_real_type>;
+    //!@}
+
+    //! Comparison tolerance given the table storage precision
+    static constexpr real_type tol = CELERITAS_FLOAT_TABLES ? 1e-6 : 1e-12;
+
+  protected:
+    //! Construct the table from the values at each grid point
+    void build(VecReal values)
+    {
+        data.log_energy = celeritas::UniformGridPointers::from_bounds(
+            std::log(0.1), std::log(100), 4);
+        this->values = std::move(values);
+        data.value   = celeritas::make_span(this->values);
+    }
+
+    VecReal                   values;
+    celeritas::XsGridPointers data;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_test
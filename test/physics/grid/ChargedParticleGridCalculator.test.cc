@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ChargedParticleGridCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/ChargedParticleGridCalculator.hh"
+
+#include <cmath>
+#include "CalculatorTestBase.hh"
+#include "celeritas_test.hh"
+
+using celeritas::EnergyLossCalculator;
+using celeritas::RangeCalculator;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ChargedParticleGridCalculatorTest
+    : public celeritas_test::CalculatorTestBase
+{
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ChargedParticleGridCalculatorTest, energy_loss)
+{
+    this->build({4, 2, 1.5, 1.8});
+    EnergyLossCalculator calc_dedx(data);
+
+    // On grid points
+    EXPECT_SOFT_NEAR(4.0, calc_dedx(Energy{0.1}), tol);
+    EXPECT_SOFT_NEAR(1.5, calc_dedx(Energy{10}), tol);
+    EXPECT_SOFT_NEAR(1.8, calc_dedx(Energy{100}), tol);
+
+    // Linear interpolation in energy
+    EXPECT_SOFT_NEAR(2 - 0.5 * 4 / 9, calc_dedx(Energy{5}), tol);
+
+    // Below the table: scales with sqrt(E)
+    EXPECT_SOFT_NEAR(4.0 * std::sqrt(0.25), calc_dedx(Energy{0.025}), tol);
+    EXPECT_SOFT_NEAR(0.0, calc_dedx(Energy{0}), tol);
+
+    // Above the table: constant
+    EXPECT_SOFT_NEAR(1.8, calc_dedx(Energy{1e4}), tol);
+}
+
+TEST_F(ChargedParticleGridCalculatorTest, range)
+{
+    this->build({0.5, 1, 3, 10});
+    RangeCalculator calc_range(data);
+
+    // On grid points
+    EXPECT_SOFT_NEAR(0.5, calc_range(Energy{0.1}), tol);
+    EXPECT_SOFT_NEAR(3.0, calc_range(Energy{10}), tol);
+    EXPECT_SOFT_NEAR(10.0, calc_range(Energy{100}), tol);
+
+    // Linear interpolation in energy
+    EXPECT_SOFT_NEAR(1 + 2.0 * 4 / 9, calc_range(Energy{5}), tol);
+
+    // Below the table: scales with sqrt(E)
+    EXPECT_SOFT_NEAR(0.5 * std::sqrt(0.25), calc_range(Energy{0.025}), tol);
+
+    // Above the table: constant
+    EXPECT_SOFT_NEAR(10.0, calc_range(Energy{1e4}), tol);
+}
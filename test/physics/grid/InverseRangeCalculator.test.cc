@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseRangeCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/InverseRangeCalculator.hh"
+
+#include <vector>
+#include "physics/grid/ChargedParticleGridCalculator.hh"
+#include "physics/grid/ValueGridBuilder.hh"
+#include "physics/grid/ValueGridStore.hh"
+#include "CalculatorTestBase.hh"
+#include "celeritas_test.hh"
+
+using celeritas::InverseRangeCalculator;
+using celeritas::RangeCalculator;
+using celeritas::XsGridPointers;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class InverseRangeCalculatorTest : public celeritas_test::CalculatorTestBase
+{
+  protected:
+    void SetUp() override { this->build({0.5, 1, 3, 10}); }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(InverseRangeCalculatorTest, all)
+{
+    InverseRangeCalculator calc_energy(data);
+
+    // On grid points
+    EXPECT_SOFT_NEAR(0.1, calc_energy(0.5).value(), tol);
+    EXPECT_SOFT_NEAR(10.0, calc_energy(3).value(), tol);
+    EXPECT_SOFT_NEAR(100.0, calc_energy(10).value(), tol);
+
+    // Linear interpolation in range
+    EXPECT_SOFT_NEAR(1 + 9.0 / 4, calc_energy(1.5).value(), tol);
+
+    // Below the table: scales with range squared
+    EXPECT_SOFT_NEAR(0.1 / 4, calc_energy(0.25).value(), tol);
+    EXPECT_SOFT_NEAR(0.0, calc_energy(0).value(), tol);
+
+    // Above the table: maximum energy
+    EXPECT_SOFT_NEAR(100.0, calc_energy(20).value(), tol);
+}
+
+TEST_F(InverseRangeCalculatorTest, round_trip)
+{
+    // Build from Geant4-style inverse range data (axes swapped)
+    std::vector<real_type> g4_range  = {0.5, 1, 3, 10};
+    std::vector<real_type> g4_energy = {0.1, 1, 10, 100};
+    auto build = celeritas::ValueGridLogBuilder::from_inverse_range(
+        celeritas::make_span(g4_range), celeritas::make_span(g4_energy));
+
+    celeritas::ValueGridStore store;
+    auto id = build.build(celeritas::ValueGridType::range, &store);
+    XsGridPointers ptrs = store.host_pointers(id);
+    ASSERT_FALSE(ptrs.energy.empty());
+
+    RangeCalculator        calc_range(ptrs);
+    InverseRangeCalculator calc_energy(ptrs);
+    for (real_type e : {0.01, 0.1, 0.2, 0.99, 1.0, 5.0, 33.0, 99.0})
+    {
+        real_type r = calc_range(Energy{e});
+        EXPECT_SOFT_NEAR(e, calc_energy(r).value(), 10 * tol) << "at E=" << e;
+    }
+}
@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LogGridResampler.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/LogGridResampler.hh"
+
+#include <cmath>
+#include <vector>
+#include "base/Range.hh"
+#include "physics/grid/PhysicsGridCalculator.hh"
+#include "celeritas_test.hh"
+
+using celeritas::LogGridResampler;
+using celeritas::make_span;
+using celeritas::PhysicsGridCalculator;
+using celeritas::range;
+using celeritas::ResampledGrid;
+using celeritas::XsGridPointers;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class LogGridResamplerTest : public celeritas::Test
+{
+  protected:
+    using real_type = celeritas::real_type;
+    using Energy    = PhysicsGridCalculator::Energy;
+
+    // Tabulate a function on a nonuniform grid
+    template<class F>
+    void tabulate(F&& func, real_type emin, real_type emax, int count)
+    {
+        energy.clear();
+        value.clear();
+        for (auto i : range(count))
+        {
+            // Points clustered toward low energy
+            real_type frac = std::pow(real_type(i) / (count - 1), 2);
+            energy.push_back(emin * std::pow(emax / emin, frac));
+            value.push_back(func(energy.back()));
+        }
+    }
+
+    std::vector<real_type> energy;
+    std::vector<real_type> value;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(LogGridResamplerTest, smooth)
+{
+    auto func = [](real_type e) { return 2 / std::sqrt(e) + 0.1 * e; };
+    this->tabulate(func, 1e-3, 1e3, 200);
+
+    LogGridResampler resample({1e-3});
+    ResampledGrid    grid = resample(make_span(energy), make_span(value));
+    EXPECT_LE(grid.max_error, 1e-3);
+    EXPECT_GT(grid.max_error_energy, 0);
+    EXPECT_EQ(grid.log_energy.size, grid.value.size());
+    EXPECT_SOFT_EQ(std::log(1e-3), grid.log_energy.front);
+    EXPECT_SOFT_EQ(std::log(1e3), grid.log_energy.back);
+    EXPECT_EQ(value.front(), grid.value.front());
+    EXPECT_EQ(value.back(), grid.value.back());
+
+    // Check the resampled grid with the standard calculator against the
+    // *tabulated* data, which approximates the function to a similar degree
+    std::vector<celeritas::grid_real_type> values(grid.value.begin(),
+                                                  grid.value.end());
+    XsGridPointers                         ptrs;
+    ptrs.log_energy = grid.log_energy;
+    ptrs.value      = make_span(values);
+    PhysicsGridCalculator calc(ptrs);
+    for (real_type e : {1e-3, 2e-3, 0.1, 0.5, 1.0, 10.0, 999.0})
+    {
+        EXPECT_SOFT_NEAR(func(e), calc(Energy{e}), 2e-3) << "at E=" << e;
+    }
+
+    // A tighter tolerance requires more points
+    ResampledGrid fine
+        = LogGridResampler({1e-4})(make_span(energy), make_span(value));
+    EXPECT_LE(fine.max_error, 1e-4);
+    EXPECT_GT(fine.value.size(), grid.value.size());
+}
+
+TEST_F(LogGridResamplerTest, already_uniform)
+{
+    // Uniform in log and linear in log-log: resampling keeps the size
+    energy = {1, 10, 100, 1000};
+    value  = {1, 1, 1, 1};
+
+    ResampledGrid grid
+        = LogGridResampler({1e-6})(make_span(energy), make_span(value));
+    EXPECT_EQ(4, grid.value.size());
+    EXPECT_EQ(0, grid.max_error);
+}
+
+TEST_F(LogGridResamplerTest, threshold)
+{
+    // Cross section that rises from zero at the threshold (the first point)
+    auto func = [](real_type e) { return std::log(e); };
+    this->tabulate(func, 1, 1e4, 100);
+
+    ResampledGrid grid
+        = LogGridResampler({1e-3})(make_span(energy), make_span(value));
+    EXPECT_LE(grid.max_error, 1e-3);
+    EXPECT_EQ(0, grid.value.front());
+}
+
+TEST_F(LogGridResamplerTest, discontinuity)
+{
+    // Absorption edge can't be represented on a uniform grid
+    energy = {1, 2, 2, 10};
+    value  = {1, 1, 5, 5};
+
+    LogGridResampler::Options opts;
+    opts.max_error = 1e-3;
+    opts.max_size  = 100;
+    LogGridResampler resample(opts);
+    EXPECT_THROW(resample(make_span(energy), make_span(value)),
+                 celeritas::RuntimeError);
+}
@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MultiPhysicsGridCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/MultiPhysicsGridCalculator.hh"
+
+#include <cmath>
+#include <vector>
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using celeritas::MultiPhysicsGridCalculator;
+using celeritas::UniformGridPointers;
+using celeritas::XsGridPointers;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class MultiPhysicsGridCalculatorTest : public celeritas::Test
+{
+  protected:
+    using Energy    = MultiPhysicsGridCalculator::Energy;
+    using real_type = celeritas::real_type;
+    using VecValue  = std::vector<celeritas::grid_real_type>;
+
+    //! Comparison tolerance given the table storage precision
+    static constexpr real_type tol = CELERITAS_FLOAT_TABLES ? 1e-6 : 1e-12;
+
+    void SetUp() override
+    {
+        // Energy from 1 to 1e4 MeV with 5 grid points
+        const int size = 5;
+        log_energy = UniformGridPointers::from_bounds(
+            std::log(1.0), std::log(1e4), size);
+        for (auto i : celeritas::range(size))
+        {
+            energy.push_back(std::pow(10.0, i));
+        }
+
+        // Constant cross section of 2, unscaled
+        xs_a.assign(size, 2.0);
+
+        // Cross section of 3 / E, scaled by E for the upper two points
+        for (auto i : celeritas::range(size))
+        {
+            xs_b.push_back(i < 3 ? 3.0 / energy[i] : 3.0);
+        }
+
+        // Cross section equal to E, unscaled
+        xs_c = energy;
+
+        tables.resize(3);
+        for (auto& t : tables)
+        {
+            t.log_energy = log_energy;
+        }
+        tables[0].value       = celeritas::make_span(xs_a);
+        tables[1].value       = celeritas::make_span(xs_b);
+        tables[1].prime_index = 3;
+        tables[2].value       = celeritas::make_span(xs_c);
+    }
+
+    UniformGridPointers         log_energy;
+    VecValue                    energy;
+    VecValue                    xs_a;
+    VecValue                    xs_b;
+    VecValue                    xs_c;
+    std::vector<XsGridPointers> tables;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(MultiPhysicsGridCalculatorTest, all)
+{
+    std::vector<real_type> xs(tables.size());
+    for (bool precomputed : {false, true})
+    {
+        if (precomputed)
+        {
+            for (auto& t : tables)
+            {
+                t.energy = celeritas::make_span(energy);
+            }
+        }
+
+        // On grid point
+        MultiPhysicsGridCalculator calc(tables[0], Energy{100});
+        EXPECT_EQ(2, calc.lower_index());
+        calc(celeritas::make_span(tables), celeritas::make_span(xs));
+        EXPECT_SOFT_NEAR(2.0, xs[0], tol);
+        EXPECT_SOFT_NEAR(0.03, xs[1], tol);
+        EXPECT_SOFT_NEAR(100, xs[2], tol);
+
+        // Interior points, including bin above and below prime index
+        for (real_type e : {5.0, 500.0, 5000.0})
+        {
+            MultiPhysicsGridCalculator calc(tables[0], Energy{e});
+            calc(celeritas::make_span(tables), celeritas::make_span(xs));
+            EXPECT_SOFT_NEAR(2.0, xs[0], tol);
+            EXPECT_SOFT_NEAR(e, xs[2], tol);
+            if (e > 1000)
+            {
+                EXPECT_SOFT_NEAR(3.0 / e, xs[1], tol);
+            }
+        }
+
+        // Linear interpolation of 3/E between 100 and 1000
+        EXPECT_SOFT_NEAR(
+            0.03 + (0.003 - 0.03) * 400 / 900,
+            MultiPhysicsGridCalculator(tables[0], Energy{500})(tables[1]),
+            tol);
+
+        // Out of bounds
+        MultiPhysicsGridCalculator calc_lo(tables[0], Energy{0.1});
+        EXPECT_EQ(0, calc_lo.lower_index());
+        EXPECT_SOFT_NEAR(2.0, calc_lo(tables[0]), tol);
+        EXPECT_SOFT_NEAR(3.0, calc_lo(tables[1]), tol);
+        EXPECT_SOFT_NEAR(1.0, calc_lo(tables[2]), tol);
+
+        MultiPhysicsGridCalculator calc_hi(tables[0], Energy{1e5});
+        EXPECT_EQ(4, calc_hi.lower_index());
+        EXPECT_SOFT_NEAR(2.0, calc_hi(tables[0]), tol);
+        EXPECT_SOFT_NEAR(3e-5, calc_hi(tables[1]), tol);
+        EXPECT_SOFT_NEAR(1e4, calc_hi(tables[2]), tol);
+    }
+}
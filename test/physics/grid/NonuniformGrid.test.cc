@@ -0,0 +1,100 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NonuniformGrid.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/NonuniformGrid.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using celeritas::make_span;
+using celeritas::NonuniformGrid;
+using celeritas::range;
+using celeritas::real_type;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class NonuniformGridTest : public celeritas::Test
+{
+  protected:
+    using GridT = NonuniformGrid<real_type>;
+
+    void SetUp() override { data = {1.0, 2.5, 3.0, 10.0}; }
+
+    std::vector<real_type> data;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(NonuniformGridTest, accessors)
+{
+    GridT grid(make_span(data));
+    EXPECT_EQ(4, grid.size());
+    EXPECT_DOUBLE_EQ(1.0, grid.front());
+    EXPECT_DOUBLE_EQ(10.0, grid.back());
+    EXPECT_DOUBLE_EQ(2.5, grid[1]);
+    EXPECT_EQ(data.data(), grid.values().data());
+}
+
+TEST_F(NonuniformGridTest, find)
+{
+    GridT grid(make_span(data));
+#if CELERITAS_DEBUG
+    EXPECT_THROW(grid.find(0.99999), celeritas::DebugError);
+#endif
+    EXPECT_EQ(0, grid.find(1.0));
+    EXPECT_EQ(0, grid.find(2.49999));
+    EXPECT_EQ(1, grid.find(2.5));
+    EXPECT_EQ(1, grid.find(2.99999));
+    EXPECT_EQ(2, grid.find(3.0));
+    EXPECT_EQ(2, grid.find(9.99999));
+#if CELERITAS_DEBUG
+    EXPECT_THROW(grid.find(10.0), celeritas::DebugError);
+#endif
+}
+
+TEST_F(NonuniformGridTest, single_bin)
+{
+    data = {-1.0, 1.0};
+    GridT grid(make_span(data));
+    EXPECT_EQ(0, grid.find(-1.0));
+    EXPECT_EQ(0, grid.find(0.99999));
+}
+
+TEST_F(NonuniformGridTest, all_sizes)
+{
+    // Compare against the standard library for grids of various sizes,
+    // including non-powers-of-two, at every grid point and bin midpoint
+    for (auto size : range(2, 40))
+    {
+        data.resize(size);
+        for (auto i : range(size))
+        {
+            data[i] = std::exp(0.3 * i + 0.01 * i * i) - 1;
+        }
+
+        GridT grid(make_span(data));
+        for (auto i : range(size - 1))
+        {
+            for (real_type value :
+                 {data[i], (data[i] + data[i + 1]) / 2,
+                  std::nextafter(data[i + 1], data[i])})
+            {
+                auto expected = std::upper_bound(data.begin(), data.end(), value)
+                                - data.begin() - 1;
+                EXPECT_EQ(expected, grid.find(value))
+                    << "size=" << size << ", value=" << value;
+            }
+        }
+    }
+}
@@ -27,6 +27,9 @@ class PhysicsGridCalculatorTest : public celeritas::Test
     using Energy    = PhysicsGridCalculator::Energy;
     using real_type = celeritas::real_type;
 
+    //! Comparison tolerance given the table storage precision
+    static constexpr real_type tol = CELERITAS_FLOAT_TABLES ? 1e-6 : 1e-12;
+
     void build(real_type emin, real_type emax, int count)
     {
         CELER_EXPECT(count >= 2);
@@ -46,11 +49,11 @@ class PhysicsGridCalculatorTest : public celeritas::Test
         data.value = celeritas::make_span(stored_xs);
 
         CELER_ENSURE(data);
-        CELER_ENSURE(celeritas::soft_equal(emax, data.value.back()));
+        CELER_ENSURE(celeritas::SoftEqual<>(tol)(emax, data.value.back()));
     }
 
-    std::vector<real_type> stored_xs;
-    XsGridPointers         data;
+    std::vector<celeritas::grid_real_type> stored_xs;
+    XsGridPointers                         data;
 };
 
 //---------------------------------------------------------------------------//
@@ -66,17 +69,17 @@ TEST_F(PhysicsGridCalculatorTest, simple)
     PhysicsGridCalculator calc(this->data);
 
     // Test on grid points
-    EXPECT_SOFT_EQ(1.0, calc(Energy{1}));
-    EXPECT_SOFT_EQ(1e2, calc(Energy{1e2}));
-    EXPECT_SOFT_EQ(1e5 - 1e-6, calc(Energy{1e5 - 1e-6}));
-    EXPECT_SOFT_EQ(1e5, calc(Energy{1e5}));
+    EXPECT_SOFT_NEAR(1.0, calc(Energy{1}), tol);
+    EXPECT_SOFT_NEAR(1e2, calc(Energy{1e2}), tol);
+    EXPECT_SOFT_NEAR(1e5 - 1e-6, calc(Energy{1e5 - 1e-6}), tol);
+    EXPECT_SOFT_NEAR(1e5, calc(Energy{1e5}), tol);
 
     // Test between grid points
-    EXPECT_SOFT_EQ(5, calc(Energy{5}));
+    EXPECT_SOFT_NEAR(5, calc(Energy{5}), tol);
 
     // Test out-of-bounds
-    EXPECT_SOFT_EQ(1.0, calc(Energy{0.0001}));
-    EXPECT_SOFT_EQ(1e5, calc(Energy{1e7}));
+    EXPECT_SOFT_NEAR(1.0, calc(Energy{0.0001}), tol);
+    EXPECT_SOFT_NEAR(1e5, calc(Energy{1e7}), tol);
 }
 
 TEST_F(PhysicsGridCalculatorTest, scaled_lowest)
@@ -89,19 +92,19 @@ TEST_F(PhysicsGridCalculatorTest, scaled_lowest)
     PhysicsGridCalculator calc(this->data);
 
     // Test on grid points
-    EXPECT_SOFT_EQ(1, calc(Energy{0.1}));
-    EXPECT_SOFT_EQ(1, calc(Energy{1e2}));
-    EXPECT_SOFT_EQ(1, calc(Energy{1e4 - 1e-6}));
-    EXPECT_SOFT_EQ(1, calc(Energy{1e4}));
+    EXPECT_SOFT_NEAR(1, calc(Energy{0.1}), tol);
+    EXPECT_SOFT_NEAR(1, calc(Energy{1e2}), tol);
+    EXPECT_SOFT_NEAR(1, calc(Energy{1e4 - 1e-6}), tol);
+    EXPECT_SOFT_NEAR(1, calc(Energy{1e4}), tol);
 
     // Test between grid points
-    EXPECT_SOFT_EQ(1, calc(Energy{0.2}));
-    EXPECT_SOFT_EQ(1, calc(Energy{5}));
+    EXPECT_SOFT_NEAR(1, calc(Energy{0.2}), tol);
+    EXPECT_SOFT_NEAR(1, calc(Energy{5}), tol);
 
     // Test out-of-bounds: cross section still scales according to 1/E (TODO:
     // this might not be the best behavior for the lower energy value)
-    EXPECT_SOFT_EQ(1000, calc(Energy{0.0001}));
-    EXPECT_SOFT_EQ(0.1, calc(Energy{1e5}));
+    EXPECT_SOFT_NEAR(1000, calc(Energy{0.0001}), tol);
+    EXPECT_SOFT_NEAR(0.1, calc(Energy{1e5}), tol);
 }
 
 TEST_F(PhysicsGridCalculatorTest, scaled_middle)
@@ -113,7 +116,7 @@ TEST_F(PhysicsGridCalculatorTest, scaled_middle)
     std::fill(this->stored_xs.begin(), this->stored_xs.begin() + 3, 1.0);
 
     // Change constant to 3 just to shake things up
-    for (real_type& xs : this->stored_xs)
+    for (auto& xs : this->stored_xs)
     {
         xs *= 3;
     }
@@ -121,19 +124,19 @@ TEST_F(PhysicsGridCalculatorTest, scaled_middle)
     PhysicsGridCalculator calc(this->data);
 
     // Test on grid points
-    EXPECT_SOFT_EQ(3, calc(Energy{0.1}));
-    EXPECT_SOFT_EQ(3, calc(Energy{1e2}));
-    EXPECT_SOFT_EQ(3, calc(Energy{1e4 - 1e-6}));
-    EXPECT_SOFT_EQ(3, calc(Energy{1e4}));
+    EXPECT_SOFT_NEAR(3, calc(Energy{0.1}), tol);
+    EXPECT_SOFT_NEAR(3, calc(Energy{1e2}), tol);
+    EXPECT_SOFT_NEAR(3, calc(Energy{1e4 - 1e-6}), tol);
+    EXPECT_SOFT_NEAR(3, calc(Energy{1e4}), tol);
 
     // Test between grid points
-    EXPECT_SOFT_EQ(3, calc(Energy{0.2}));
-    EXPECT_SOFT_EQ(3, calc(Energy{5}));
+    EXPECT_SOFT_NEAR(3, calc(Energy{0.2}), tol);
+    EXPECT_SOFT_NEAR(3, calc(Energy{5}), tol);
 
     // Test out-of-bounds: cross section still scales according to 1/E (TODO:
     // this might not be the right behavior for
-    EXPECT_SOFT_EQ(3, calc(Energy{0.0001}));
-    EXPECT_SOFT_EQ(0.3, calc(Energy{1e5}));
+    EXPECT_SOFT_NEAR(3, calc(Energy{0.0001}), tol);
+    EXPECT_SOFT_NEAR(0.3, calc(Energy{1e5}), tol);
 }
 
 TEST_F(PhysicsGridCalculatorTest, scaled_highest)
@@ -143,14 +146,14 @@ TEST_F(PhysicsGridCalculatorTest, scaled_highest)
     data.prime_index = 2;
 
     PhysicsGridCalculator calc(this->data);
-    EXPECT_SOFT_EQ(1, calc(Energy{0.0001}));
-    EXPECT_SOFT_EQ(1, calc(Energy{1}));
-    EXPECT_SOFT_EQ(10, calc(Energy{10}));
-    EXPECT_SOFT_EQ(2.0, calc(Energy{90}));
+    EXPECT_SOFT_NEAR(1, calc(Energy{0.0001}), tol);
+    EXPECT_SOFT_NEAR(1, calc(Energy{1}), tol);
+    EXPECT_SOFT_NEAR(10, calc(Energy{10}), tol);
+    EXPECT_SOFT_NEAR(2.0, calc(Energy{90}), tol);
 
     // Final point and higher are scaled by 1/E
-    EXPECT_SOFT_EQ(1, calc(Energy{100}));
-    EXPECT_SOFT_EQ(.1, calc(Energy{1000}));
+    EXPECT_SOFT_NEAR(1, calc(Energy{100}), tol);
+    EXPECT_SOFT_NEAR(.1, calc(Energy{1000}), tol);
 }
 
 TEST_F(PhysicsGridCalculatorTest, TEST_IF_CELERITAS_DEBUG(scaled_off_the_end))
@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SplineDerivCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/SplineDerivCalculator.hh"
+
+#include <cmath>
+#include <vector>
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using celeritas::make_span;
+using celeritas::range;
+using celeritas::SplineDerivCalculator;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class SplineDerivCalculatorTest : public celeritas::Test
+{
+  protected:
+    using real_type = celeritas::real_type;
+    using VecReal   = std::vector<real_type>;
+    using BC        = SplineDerivCalculator::BoundaryCondition;
+
+    // Evaluate the spline at the given point
+    real_type spline(const VecReal& deriv2, real_type xp) const
+    {
+        std::size_t i = 0;
+        while (i + 2 < x.size() && xp > x[i + 1])
+        {
+            ++i;
+        }
+        real_type h = x[i + 1] - x[i];
+        real_type b = (xp - x[i]) / h;
+        real_type a = 1 - b;
+        return a * y[i] + b * y[i + 1]
+               + h * h / 6
+                     * ((a * a - 1) * a * deriv2[i]
+                        + (b * b - 1) * b * deriv2[i + 1]);
+    }
+
+    VecReal x;
+    VecReal y;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SplineDerivCalculatorTest, two_points)
+{
+    x = {1, 2};
+    y = {3, 5};
+    for (BC bc : {BC::natural, BC::not_a_knot})
+    {
+        VecReal deriv2 = SplineDerivCalculator(bc)(make_span(x), make_span(y));
+        EXPECT_VEC_SOFT_EQ(VecReal({0, 0}), deriv2);
+    }
+}
+
+TEST_F(SplineDerivCalculatorTest, parabola)
+{
+    // y = x^2 on three points: not-a-knot gives the exact parabola
+    x = {0, 1, 3};
+    y = {0, 1, 9};
+    VecReal deriv2
+        = SplineDerivCalculator(BC::not_a_knot)(make_span(x), make_span(y));
+    EXPECT_VEC_SOFT_EQ(VecReal({2, 2, 2}), deriv2);
+    EXPECT_SOFT_EQ(0.25, this->spline(deriv2, 0.5));
+    EXPECT_SOFT_EQ(4.0, this->spline(deriv2, 2.0));
+
+    deriv2 = SplineDerivCalculator(BC::natural)(make_span(x), make_span(y));
+    EXPECT_SOFT_EQ(0.0, deriv2.front());
+    EXPECT_SOFT_EQ(3.0, deriv2[1]);
+    EXPECT_SOFT_EQ(0.0, deriv2.back());
+}
+
+TEST_F(SplineDerivCalculatorTest, cubic)
+{
+    // Not-a-knot reproduces a cubic exactly on a nonuniform grid
+    auto func = [](real_type v) { return v * v * v - 2 * v * v + 0.5; };
+    x         = {-1, -0.5, 0.25, 1, 2.5, 3};
+    for (real_type v : x)
+    {
+        y.push_back(func(v));
+    }
+
+    VecReal deriv2
+        = SplineDerivCalculator(BC::not_a_knot)(make_span(x), make_span(y));
+    for (auto i : range(x.size()))
+    {
+        EXPECT_SOFT_EQ(6 * x[i] - 4, deriv2[i]);
+    }
+    for (real_type v : {-0.9, -0.1, 0.5, 1.7, 2.9})
+    {
+        EXPECT_SOFT_EQ(func(v), this->spline(deriv2, v));
+    }
+}
+
+TEST_F(SplineDerivCalculatorTest, natural)
+{
+    // Natural spline through a line has zero curvature
+    x = {0, 1, 1.5, 4, 10};
+    for (real_type v : x)
+    {
+        y.push_back(3 * v - 1);
+    }
+    VecReal deriv2
+        = SplineDerivCalculator(BC::natural)(make_span(x), make_span(y));
+    for (real_type d : deriv2)
+    {
+        EXPECT_SOFT_NEAR(0.0, d, 1e-12);
+    }
+}
@@ -0,0 +1,218 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TotalXsCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/TotalXsCalculator.hh"
+
+#include <cmath>
+#include <vector>
+#include "base/Range.hh"
+#include "physics/grid/PhysicsGridCalculator.hh"
+#include "physics/grid/ValueGridBuilder.hh"
+#include "physics/grid/ValueGridStore.hh"
+#include "celeritas_test.hh"
+
+using celeritas::ParticleProcessId;
+using celeritas::PhysicsGridCalculator;
+using celeritas::TotalXsCalculator;
+using celeritas::TotalXsGridPointers;
+using celeritas::UniformGridPointers;
+using celeritas::ValueGridId;
+using celeritas::ValueGridStore;
+using celeritas::ValueGridTotalXsBuilder;
+using celeritas::ValueGridType;
+using celeritas::XsGridPointers;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TotalXsCalculatorTest : public celeritas::Test
+{
+  protected:
+    using Energy    = TotalXsCalculator::Energy;
+    using real_type = celeritas::real_type;
+    using size_type = celeritas::size_type;
+    using VecReal   = std::vector<real_type>;
+
+    //! Comparison tolerance given the table storage precision
+    static constexpr real_type tol = CELERITAS_FLOAT_TABLES ? 1e-6 : 1e-12;
+
+    void SetUp() override
+    {
+        // Energy from 1 to 1e4 MeV with 5 grid points
+        log_energy
+            = UniformGridPointers::from_bounds(std::log(1.0), std::log(1e4), 5);
+    }
+
+    // Add a process cross section table
+    void add_process(size_type prime_index, VecReal values)
+    {
+        ids.push_back(store.push_back(ValueGridType::macro_xs,
+                                      log_energy,
+                                      prime_index,
+                                      celeritas::make_span(values)));
+    }
+
+    // Build the total cross section table from all processes
+    TotalXsGridPointers build_total()
+    {
+        std::vector<XsGridPointers> tables;
+        for (ValueGridId id : ids)
+        {
+            tables.push_back(store.host_pointers(id));
+        }
+        ValueGridTotalXsBuilder build(celeritas::make_span(tables));
+        ValueGridId total_id = build.build(ValueGridType::total_xs, &store);
+        return store.host_total_pointers(total_id);
+    }
+
+    UniformGridPointers      log_energy;
+    ValueGridStore           store;
+    std::vector<ValueGridId> ids;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TotalXsCalculatorTest, total)
+{
+    add_process(size_type(-1), {1, 2, 3, 4, 5});
+    add_process(size_type(-1), {0, 0, 1, 1, 1});
+    add_process(2, {1, 1, 1e2, 1e3, 1e4});
+    TotalXsGridPointers data = build_total();
+    EXPECT_EQ(3, data.num_processes);
+    EXPECT_EQ(5 * 2, data.cdf.size());
+    EXPECT_EQ(1, store.usage(ValueGridType::total_xs).num_grids);
+
+    // Sum at grid points
+    const real_type expected_total[] = {2, 3, 5, 6, 7};
+    for (auto i : celeritas::range(5))
+    {
+        real_type energy = std::pow(10.0, i);
+        TotalXsCalculator calc(data, Energy{energy});
+        EXPECT_SOFT_NEAR(expected_total[i], calc.total(), tol)
+            << "at E=" << energy;
+    }
+
+    // Clamped outside the grid
+    EXPECT_SOFT_NEAR(2.0, TotalXsCalculator(data, Energy{0.1}).total(), tol);
+    EXPECT_SOFT_NEAR(7.0, TotalXsCalculator(data, Energy{1e5}).total(), tol);
+}
+
+TEST_F(TotalXsCalculatorTest, interpolate)
+{
+    // Linearly interpolated total is exact if all processes are linear
+    add_process(size_type(-1), {1, 2, 3, 4, 5});
+    add_process(size_type(-1), {0, 0, 1, 2, 1});
+    TotalXsGridPointers data = build_total();
+
+    for (real_type energy : {1.5, 20.0, 333.0, 5000.0})
+    {
+        real_type expected = 0;
+        for (ValueGridId id : ids)
+        {
+            expected += PhysicsGridCalculator(store.host_pointers(id))(
+                Energy{energy});
+        }
+        EXPECT_SOFT_NEAR(
+            expected, TotalXsCalculator(data, Energy{energy}).total(), tol)
+            << "at E=" << energy;
+    }
+}
+
+TEST_F(TotalXsCalculatorTest, select)
+{
+    add_process(size_type(-1), {1, 2, 3, 4, 5});
+    add_process(size_type(-1), {0, 0, 1, 1, 1});
+    add_process(2, {1, 1, 1e2, 1e3, 1e4});
+    TotalXsGridPointers data = build_total();
+
+    // At 10 MeV the fractions are {2/3, 0, 1/3}
+    TotalXsCalculator calc_10(data, Energy{10});
+    EXPECT_EQ(ParticleProcessId{0}, calc_10.select(0));
+    EXPECT_EQ(ParticleProcessId{0}, calc_10.select(0.66));
+    EXPECT_EQ(ParticleProcessId{2}, calc_10.select(0.67));
+    EXPECT_EQ(ParticleProcessId{2}, calc_10.select(0.999));
+
+    // At 1000 MeV the fractions are {4/6, 1/6, 1/6}
+    TotalXsCalculator calc_1000(data, Energy{1000});
+    EXPECT_EQ(ParticleProcessId{0}, calc_1000.select(0.66));
+    EXPECT_EQ(ParticleProcessId{1}, calc_1000.select(0.67));
+    EXPECT_EQ(ParticleProcessId{1}, calc_1000.select(0.83));
+    EXPECT_EQ(ParticleProcessId{2}, calc_1000.select(0.84));
+
+    // Halfway between 10 and 100 MeV: cdf {(2/3 + 3/5) / 2, (2/3 + 4/5) / 2}
+    TotalXsCalculator calc_55(data, Energy{55});
+    EXPECT_EQ(ParticleProcessId{0}, calc_55.select(0.63));
+    EXPECT_EQ(ParticleProcessId{1}, calc_55.select(0.64));
+    EXPECT_EQ(ParticleProcessId{1}, calc_55.select(0.73));
+    EXPECT_EQ(ParticleProcessId{2}, calc_55.select(0.74));
+
+    // Sampled fractions at a grid point
+    std::vector<int> counts(3, 0);
+    const int        num_samples = 6000;
+    for (auto i : celeritas::range(num_samples))
+    {
+        ++counts[calc_1000.select((i + real_type(0.5)) / num_samples).get()];
+    }
+    EXPECT_EQ(4000, counts[0]);
+    EXPECT_EQ(1000, counts[1]);
+    EXPECT_EQ(1000, counts[2]);
+}
+
+TEST_F(TotalXsCalculatorTest, threshold)
+{
+    // Total is zero below 100 MeV
+    add_process(size_type(-1), {0, 0, 1, 1, 1});
+    add_process(size_type(-1), {0, 0, 2, 3, 3});
+    TotalXsGridPointers data = build_total();
+
+    TotalXsCalculator calc_1(data, Energy{1});
+    EXPECT_EQ(0, calc_1.total());
+
+    // Fractions in the threshold bin are those at the threshold
+    TotalXsCalculator calc_55(data, Energy{55});
+    EXPECT_SOFT_NEAR(1.5, calc_55.total(), tol);
+    EXPECT_EQ(ParticleProcessId{0}, calc_55.select(0.33));
+    EXPECT_EQ(ParticleProcessId{1}, calc_55.select(0.34));
+}
+
+TEST_F(TotalXsCalculatorTest, single)
+{
+    add_process(2, {1, 1, 1e2, 1e3, 1e4});
+    TotalXsGridPointers data = build_total();
+    EXPECT_EQ(1, data.num_processes);
+    EXPECT_TRUE(data.cdf.empty());
+
+    TotalXsCalculator calc(data, Energy{300});
+    EXPECT_SOFT_NEAR(1.0, calc.total(), tol);
+    EXPECT_EQ(ParticleProcessId{0}, calc.select(0.999));
+}
+
+TEST_F(TotalXsCalculatorTest, mismatched_grid)
+{
+    add_process(size_type(-1), {1, 2, 3, 4, 5});
+    log_energy
+        = UniformGridPointers::from_bounds(std::log(1.0), std::log(1e3), 4);
+    add_process(size_type(-1), {1, 2, 3, 4});
+    EXPECT_THROW(build_total(), celeritas::RuntimeError);
+}
+
+TEST_F(TotalXsCalculatorTest, spline_process)
+{
+    // Splined cross sections would not add up to the linear total
+    add_process(size_type(-1), {1, 2, 3, 4, 5});
+    VecReal values = {5, 4, 3, 2, 1};
+    VecReal deriv2 = {0, 0.1, 0.2, 0.1, 0};
+    ids.push_back(store.push_back(ValueGridType::macro_xs,
+                                  log_energy,
+                                  size_type(-1),
+                                  celeritas::make_span(values),
+                                  celeritas::make_span(deriv2)));
+    EXPECT_THROW(build_total(), celeritas::RuntimeError);
+}
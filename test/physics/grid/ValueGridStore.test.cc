@@ -0,0 +1,296 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ValueGridStore.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/ValueGridStore.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+#include <vector>
+#include "base/Range.hh"
+#include "io/ImportPhysicsVector.hh"
+#include "physics/grid/PhysicsGridCalculator.hh"
+#include "physics/grid/ValueGridBuilder.hh"
+#include "celeritas_test.hh"
+
+using celeritas::PhysicsGridCalculator;
+using celeritas::UniformGridPointers;
+using celeritas::ValueGridId;
+using celeritas::ValueGridStore;
+using celeritas::ValueGridType;
+using celeritas::ValueGridXsBuilder;
+using celeritas::XsGridPointers;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ValueGridStoreTest : public celeritas::Test
+{
+  protected:
+    using real_type = celeritas::real_type;
+    using Energy    = PhysicsGridCalculator::Energy;
+
+    static bool is_aligned(const void* ptr)
+    {
+        return reinterpret_cast<std::uintptr_t>(ptr)
+                   % ValueGridStore::alignment
+               == 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ValueGridStoreTest, deduplicate)
+{
+    ValueGridStore store;
+
+    // Energy from 1 to 1e4 MeV with 5 grid points
+    auto log_energy
+        = UniformGridPointers::from_bounds(std::log(1.0), std::log(1e4), 5);
+    std::vector<real_type> xs_a = {1, 2, 3, 4, 5};
+    std::vector<real_type> xs_b = {5, 4, 3, 2, 1};
+
+    ValueGridId a = store.push_back(ValueGridType::macro_xs,
+                                    log_energy,
+                                    celeritas::size_type(-1),
+                                    celeritas::make_span(xs_a));
+    ValueGridId b = store.push_back(ValueGridType::macro_xs,
+                                    log_energy,
+                                    3,
+                                    celeritas::make_span(xs_b));
+    // Same values as xs_a, different "material"
+    std::vector<real_type> xs_c = xs_a;
+    ValueGridId            c    = store.push_back(ValueGridType::energy_loss,
+                                    log_energy,
+                                    celeritas::size_type(-1),
+                                    celeritas::make_span(xs_c));
+    EXPECT_EQ(3, store.size());
+
+    // Two value arrays and one shared energy array, each padded to 64 bytes
+    // (in single precision each array still fits in a single block)
+    const auto& xs_usage = store.usage(ValueGridType::macro_xs);
+    EXPECT_EQ(2, xs_usage.num_grids);
+    EXPECT_EQ(3, xs_usage.num_arrays);
+    EXPECT_EQ(3 * 64, xs_usage.num_bytes);
+    const auto& eloss_usage = store.usage(ValueGridType::energy_loss);
+    EXPECT_EQ(1, eloss_usage.num_grids);
+    EXPECT_EQ(0, eloss_usage.num_arrays);
+    EXPECT_EQ(0, eloss_usage.num_bytes);
+    EXPECT_EQ(0, store.usage(ValueGridType::range).num_grids);
+    EXPECT_EQ(3 * 64, store.num_bytes());
+
+    XsGridPointers ptrs_a = store.host_pointers(a);
+    XsGridPointers ptrs_b = store.host_pointers(b);
+    XsGridPointers ptrs_c = store.host_pointers(c);
+    EXPECT_EQ(ptrs_a.value.data(), ptrs_c.value.data());
+    EXPECT_NE(ptrs_a.value.data(), ptrs_b.value.data());
+    EXPECT_EQ(ptrs_a.energy.data(), ptrs_b.energy.data());
+    EXPECT_EQ(celeritas::size_type(-1), ptrs_a.prime_index);
+    EXPECT_EQ(3, ptrs_b.prime_index);
+    EXPECT_VEC_SOFT_EQ(
+        (std::vector<real_type>{1, 10, 100, 1000, 1e4}),
+        std::vector<real_type>(ptrs_a.energy.begin(), ptrs_a.energy.end()));
+    for (const XsGridPointers& ptrs : {ptrs_a, ptrs_b, ptrs_c})
+    {
+        EXPECT_TRUE(is_aligned(ptrs.value.data()));
+        EXPECT_TRUE(is_aligned(ptrs.energy.data()));
+    }
+
+    // Copy to device (host memory if CUDA is disabled) in one transfer
+    store.copy_to_device();
+    EXPECT_TRUE(store.has_device_data());
+    XsGridPointers device_b = store.device_pointers(b);
+    EXPECT_TRUE(is_aligned(device_b.value.data()));
+    EXPECT_TRUE(is_aligned(device_b.energy.data()));
+    EXPECT_EQ(5, device_b.value.size());
+    EXPECT_EQ(3, device_b.prime_index);
+
+#if !CELERITAS_FLOAT_TABLES
+    EXPECT_EQ(0, xs_usage.max_error);
+
+    std::ostringstream os;
+    write_json(os, store);
+    EXPECT_EQ(
+        R"json({"num_bytes":192,"tables":{"macro_xs":{"num_grids":2,"num_arrays":3,"num_bytes":192,"max_error":0},"energy_loss":{"num_grids":1,"num_arrays":0,"num_bytes":0,"max_error":0},"range":{"num_grids":0,"num_arrays":0,"num_bytes":0,"max_error":0},"total_xs":{"num_grids":0,"num_arrays":0,"num_bytes":0,"max_error":0}}})json",
+        os.str());
+#else
+    EXPECT_LT(xs_usage.max_error, 1e-6);
+#endif
+}
+
+TEST_F(ValueGridStoreTest, xs_builder)
+{
+    // Cross section of 1 from 1 to 100 MeV, scaled by E from 100 to 1e4 MeV
+    ValueGridXsBuilder build_xs(1.0, 100.0, 1e4, {1, 1, 100, 1000, 1e4});
+
+    ValueGridStore store;
+    ValueGridId    id = build_xs.build(ValueGridType::macro_xs, &store);
+    EXPECT_EQ(0, id.get());
+
+    XsGridPointers ptrs = store.host_pointers(id);
+    EXPECT_EQ(2, ptrs.prime_index);
+    EXPECT_EQ(5, ptrs.value.size());
+
+    PhysicsGridCalculator calc_xs(ptrs);
+    EXPECT_SOFT_EQ(1.0, calc_xs(Energy{1}));
+    EXPECT_SOFT_EQ(1.0, calc_xs(Energy{50}));
+    EXPECT_SOFT_EQ(1.0, calc_xs(Energy{100}));
+    EXPECT_SOFT_EQ(1.0, calc_xs(Energy{5000}));
+}
+
+TEST_F(ValueGridStoreTest, log_builder)
+{
+    // dE/dx and range at 0.1, 1, 10, 100 MeV
+    std::vector<real_type> energy = {0.1, 1, 10, 100};
+    std::vector<real_type> dedx   = {4, 2, 1.5, 1.8};
+    std::vector<real_type> range  = {0.5, 1, 3, 10};
+
+    auto build_dedx = celeritas::ValueGridLogBuilder::from_geant(
+        celeritas::make_span(energy), celeritas::make_span(dedx));
+    auto build_range = celeritas::ValueGridLogBuilder::from_geant(
+        celeritas::make_span(energy), celeritas::make_span(range));
+    EXPECT_EQ(celeritas::ValueCalculation::linear,
+              build_dedx.value_storage().first);
+    EXPECT_EQ(4, build_dedx.value_storage().second);
+
+    ValueGridStore store;
+    ValueGridId    dedx_id
+        = build_dedx.build(ValueGridType::energy_loss, &store);
+    ValueGridId range_id = build_range.build(ValueGridType::range, &store);
+    EXPECT_EQ(1, store.usage(ValueGridType::energy_loss).num_grids);
+    EXPECT_EQ(1, store.usage(ValueGridType::range).num_grids);
+
+    XsGridPointers dedx_ptrs = store.host_pointers(dedx_id);
+    EXPECT_EQ(celeritas::size_type(-1), dedx_ptrs.prime_index);
+    EXPECT_EQ(4, dedx_ptrs.value.size());
+    EXPECT_EQ(dedx_ptrs.energy.data(),
+              store.host_pointers(range_id).energy.data());
+
+#if CELERITAS_DEBUG
+    // Range must be strictly increasing
+    range[2] = 1;
+    auto build_bad = celeritas::ValueGridLogBuilder::from_geant(
+        celeritas::make_span(energy), celeritas::make_span(range));
+    EXPECT_THROW(build_bad.build(ValueGridType::range, &store),
+                 celeritas::DebugError);
+
+    // Range cannot be a spline since it must be invertible
+    std::vector<real_type> fine_range(16);
+    std::iota(fine_range.begin(), fine_range.end(), real_type(1));
+    celeritas::ValueGridLogBuilder build_spline(
+        0.1, 100, fine_range, celeritas::ValueCalculation::spline);
+    EXPECT_THROW(build_spline.build(ValueGridType::range, &store),
+                 celeritas::DebugError);
+#endif
+}
+
+TEST_F(ValueGridStoreTest, free_builder)
+{
+    // Nonuniform cross sections with an absorption edge
+    celeritas::ImportPhysicsVector vec;
+    vec.vector_type = celeritas::ImportPhysicsVectorType::free;
+    vec.x           = {1e-3, 1.5e-3, 4e-3, 4.4e-3, 0.02, 0.3, 1, 10};
+    vec.y           = {50, 30, 8, 20, 5, 1, 0.8, 0.5};
+
+    celeritas::LogGridResampler::Options opts;
+    opts.max_error = 1e-2;
+    auto build_xs  = celeritas::ValueGridLogBuilder::from_free(vec, opts);
+    EXPECT_EQ(celeritas::ValueCalculation::linear,
+              build_xs.value_storage().first);
+    EXPECT_LT(vec.x.size(), build_xs.value_storage().second);
+
+    ValueGridStore store;
+    ValueGridId    id = build_xs.build(ValueGridType::macro_xs, &store);
+    XsGridPointers ptrs = store.host_pointers(id);
+    EXPECT_EQ(build_xs.value_storage().second, ptrs.value.size());
+    EXPECT_EQ(celeritas::size_type(-1), ptrs.prime_index);
+    EXPECT_SOFT_EQ(std::log(1e-3), ptrs.log_energy.front);
+    EXPECT_SOFT_EQ(std::log(10.0), ptrs.log_energy.back);
+
+    // Resampled table reproduces the input at every input point
+    PhysicsGridCalculator calc_xs(ptrs);
+    for (auto i : celeritas::range(vec.x.size()))
+    {
+        EXPECT_SOFT_NEAR(vec.y[i], calc_xs(Energy{vec.x[i]}), 1e-2);
+    }
+}
+
+TEST_F(ValueGridStoreTest, spline_builder)
+{
+    // Smooth stopping-power-like function with 5 points per decade
+    auto func = [](real_type e) { return 2 / std::sqrt(e) + 0.1 * e; };
+    const real_type        emin = 0.1;
+    const real_type        emax = 100;
+    std::vector<real_type> value;
+    for (auto i : celeritas::range(16))
+    {
+        value.push_back(func(emin * std::pow(10.0, i * 0.2)));
+    }
+
+    celeritas::ValueGridLogBuilder build_linear(emin, emax, value);
+    celeritas::ValueGridLogBuilder build_spline(
+        emin, emax, value, celeritas::ValueCalculation::spline);
+    EXPECT_EQ(celeritas::ValueCalculation::spline,
+              build_spline.value_storage().first);
+    EXPECT_EQ(32, build_spline.value_storage().second);
+
+    ValueGridStore store;
+    ValueGridId    linear_id
+        = build_linear.build(ValueGridType::energy_loss, &store);
+    ValueGridId spline_id
+        = build_spline.build(ValueGridType::energy_loss, &store);
+
+    XsGridPointers linear_ptrs = store.host_pointers(linear_id);
+    XsGridPointers spline_ptrs = store.host_pointers(spline_id);
+    EXPECT_TRUE(linear_ptrs.deriv2.empty());
+    EXPECT_EQ(16, spline_ptrs.deriv2.size());
+    EXPECT_EQ(linear_ptrs.value.data(), spline_ptrs.value.data());
+
+    PhysicsGridCalculator calc_linear(linear_ptrs);
+    PhysicsGridCalculator calc_spline(spline_ptrs);
+    real_type             max_linear_err = 0;
+    real_type             max_spline_err = 0;
+    for (real_type e : {0.15, 0.5, 2.0, 5.0, 20.0, 70.0})
+    {
+        real_type expected = func(e);
+        max_linear_err     = std::max(
+            max_linear_err,
+            std::fabs(calc_linear(Energy{e}) - expected) / expected);
+        max_spline_err = std::max(
+            max_spline_err,
+            std::fabs(calc_spline(Energy{e}) - expected) / expected);
+    }
+    EXPECT_LT(max_spline_err, 0.25 * max_linear_err);
+
+    // Values on grid points are unchanged
+    EXPECT_SOFT_NEAR(value[5], calc_spline(Energy{1.0}), 1e-6);
+
+    // Interpolant is accurate everywhere at the minimum grid density
+    for (auto i : celeritas::range(301))
+    {
+        real_type e = emin * std::pow(10.0, i * 0.01);
+        EXPECT_SOFT_NEAR(func(e), calc_spline(Energy{e}), 1e-2)
+            << "at E=" << e;
+    }
+
+    // Coarser grids can overshoot to negative values and are rejected
+    std::vector<real_type> coarse_value;
+    for (auto i : celeritas::range(7))
+    {
+        coarse_value.push_back(func(emin * std::pow(10.0, i * 0.5)));
+    }
+    EXPECT_THROW(
+        celeritas::ValueGridLogBuilder(
+            emin, emax, coarse_value, celeritas::ValueCalculation::spline),
+        celeritas::RuntimeError);
+    EXPECT_NO_THROW(celeritas::ValueGridLogBuilder(emin, emax, coarse_value));
+}
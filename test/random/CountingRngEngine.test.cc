@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CountingRngEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "random/CountingRngEngine.hh"
+
+#include <random>
+#include "base/Range.hh"
+#include "random/distributions/ExponentialDistribution.hh"
+#include "random/philox/PhiloxEngine.hh"
+#include "celeritas_test.hh"
+
+using celeritas::CountingRngEngine;
+using celeritas::EventId;
+using celeritas::generate_canonical;
+using celeritas::PhiloxEngine;
+using celeritas::TrackId;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(CountingRngEngineTest, std_engine)
+{
+    std::mt19937 expected_rng;
+    std::mt19937 actual_rng;
+
+    CountingRngEngine<std::mt19937> counted(actual_rng);
+    EXPECT_EQ(0, counted.count());
+
+    EXPECT_EQ(expected_rng(), counted());
+    EXPECT_EQ(1, counted.count());
+
+    // Canonical samples count as a single draw, with an identical stream
+    EXPECT_EQ(generate_canonical<double>(expected_rng),
+              generate_canonical<double>(counted));
+    EXPECT_EQ(generate_canonical<float>(expected_rng),
+              generate_canonical<float>(counted));
+    EXPECT_EQ(3, counted.count());
+    EXPECT_EQ(expected_rng(), actual_rng());
+
+    counted.reset_count();
+    EXPECT_EQ(0, counted.count());
+}
+
+TEST(CountingRngEngineTest, philox)
+{
+    auto         key = celeritas::make_philox_key(12345);
+    PhiloxEngine expected_rng(key, EventId{0}, TrackId{3}, 1);
+    PhiloxEngine actual_rng(key, EventId{0}, TrackId{3}, 1);
+
+    // Rejection sampling through a distribution
+    celeritas::ExponentialDistribution<double> sample_exp(2.0);
+    CountingRngEngine<PhiloxEngine>            counted(actual_rng);
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(100))
+    {
+        EXPECT_EQ(sample_exp(expected_rng), sample_exp(counted));
+    }
+    EXPECT_EQ(100, counted.count());
+    EXPECT_EQ(expected_rng(), actual_rng());
+}
@@ -0,0 +1,173 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngCheckpoint.test.cc
+//---------------------------------------------------------------------------//
+#include "random/RngCheckpoint.hh"
+
+#include <sstream>
+#include <vector>
+#include "base/Range.hh"
+#include "random/cuda/RngEngine.hh"
+#include "random/cuda/RngStateStore.hh"
+#include "random/philox/PhiloxEngine.hh"
+#include "random/philox/PhiloxStateStore.hh"
+#include "celeritas_test.hh"
+
+using celeritas::EventId;
+using celeritas::MemSpace;
+using celeritas::PhiloxEngine;
+using celeritas::PhiloxStateStore;
+using celeritas::read_rng_checkpoint;
+using celeritas::RngEngine;
+using celeritas::RngStateStore;
+using celeritas::RuntimeError;
+using celeritas::ThreadId;
+using celeritas::TrackId;
+using celeritas::write_rng_checkpoint;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+template<class Engine>
+std::vector<unsigned int> sample(Engine rng, int count)
+{
+    std::vector<unsigned int> result;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(count))
+    {
+        result.push_back(rng());
+    }
+    return result;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(RngCheckpointTest, xorwow)
+{
+    RngStateStore states(16, MemSpace::host);
+    auto          ptrs = states.device_pointers();
+
+    // Advance the slots unevenly so the checkpoint is mid-stream
+    for (auto i : celeritas::range(16u))
+    {
+        RngEngine rng(ptrs, ThreadId{i});
+        for (CELER_MAYBE_UNUSED auto j : celeritas::range(i))
+        {
+            rng();
+        }
+    }
+
+    std::stringstream ss;
+    write_rng_checkpoint(ss, states);
+    const std::string checkpoint = ss.str();
+    // Header plus 48 bytes per state
+    EXPECT_EQ(32 + 16 * sizeof(celeritas::RngState), checkpoint.size());
+
+    auto expected_5  = sample(RngEngine(ptrs, ThreadId{5}), 10);
+    auto expected_15 = sample(RngEngine(ptrs, ThreadId{15}), 10);
+
+    // Restore all states
+    {
+        std::istringstream is(checkpoint);
+        RngStateStore      restored;
+        read_rng_checkpoint(is, &restored);
+        EXPECT_EQ(16, restored.size());
+        EXPECT_EQ(MemSpace::host, restored.memspace());
+        EXPECT_VEC_EQ(
+            expected_5,
+            sample(RngEngine(restored.device_pointers(), ThreadId{5}), 10));
+    }
+
+    // Replay a single slot
+    {
+        std::istringstream is(checkpoint);
+        RngStateStore      replay;
+        read_rng_checkpoint(is, ThreadId{15}, &replay);
+        EXPECT_EQ(1, replay.size());
+        EXPECT_VEC_EQ(
+            expected_15,
+            sample(RngEngine(replay.device_pointers(), ThreadId{0}), 10));
+    }
+}
+
+TEST(RngCheckpointTest, philox)
+{
+    PhiloxStateStore states(8, MemSpace::host, 9876);
+    auto             ptrs = states.device_pointers();
+    for (auto i : celeritas::range(8u))
+    {
+        ptrs.step[i] = 3 * i;
+    }
+
+    std::stringstream ss;
+    write_rng_checkpoint(ss, states);
+    const std::string checkpoint = ss.str();
+    EXPECT_EQ(32 + 8 + 8 * sizeof(unsigned int), checkpoint.size());
+
+    auto expected = sample(
+        PhiloxEngine(ptrs, ThreadId{6}, EventId{1}, TrackId{37}), 10);
+
+    // Restore all counters
+    {
+        std::istringstream is(checkpoint);
+        PhiloxStateStore   restored;
+        read_rng_checkpoint(is, &restored);
+        EXPECT_EQ(8, restored.size());
+        EXPECT_EQ(states.key(), restored.key());
+        std::vector<unsigned int> steps(8);
+        restored.copy_to_host(celeritas::make_span(steps));
+        EXPECT_EQ(18, steps[6]);
+    }
+
+    // Replay a single track: the stream also depends on event and track IDs
+    {
+        std::istringstream is(checkpoint);
+        PhiloxStateStore   replay;
+        read_rng_checkpoint(is, ThreadId{6}, &replay);
+        EXPECT_EQ(1, replay.size());
+        EXPECT_VEC_EQ(expected,
+                      sample(PhiloxEngine(replay.device_pointers(),
+                                          ThreadId{0},
+                                          EventId{1},
+                                          TrackId{37}),
+                             10));
+    }
+}
+
+TEST(RngCheckpointTest, errors)
+{
+    std::stringstream ss;
+    write_rng_checkpoint(ss, PhiloxStateStore(4, MemSpace::host));
+    const std::string checkpoint = ss.str();
+
+    // Wrong generator type
+    {
+        std::istringstream is(checkpoint);
+        RngStateStore      states;
+        EXPECT_THROW(read_rng_checkpoint(is, &states), RuntimeError);
+    }
+    // Slot out of range
+    {
+        std::istringstream is(checkpoint);
+        PhiloxStateStore   states;
+        EXPECT_THROW(read_rng_checkpoint(is, ThreadId{4}, &states),
+                     RuntimeError);
+    }
+    // Truncated file
+    {
+        std::istringstream is(checkpoint.substr(0, checkpoint.size() - 1));
+        PhiloxStateStore   states;
+        EXPECT_THROW(read_rng_checkpoint(is, &states), RuntimeError);
+    }
+    // Not a checkpoint
+    {
+        std::istringstream is(std::string(64, 'x'));
+        PhiloxStateStore   states;
+        EXPECT_THROW(read_rng_checkpoint(is, &states), RuntimeError);
+    }
+}
@@ -0,0 +1,154 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Xorwow.test.cc
+//---------------------------------------------------------------------------//
+#include "random/cuda/RngEngine.hh"
+
+#include <vector>
+#include "base/Range.hh"
+#include "random/cuda/RngStateStore.hh"
+#include "celeritas_test.hh"
+
+using celeritas::generate_canonical;
+using celeritas::MemSpace;
+using celeritas::RngEngine;
+using celeritas::RngState;
+using celeritas::RngStatePointers;
+using celeritas::RngStateStore;
+using celeritas::ThreadId;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+std::vector<unsigned int> state_vector(const RngState& s)
+{
+    return {s.d, s.v[0], s.v[1], s.v[2], s.v[3], s.v[4]};
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+// Values must match the device regression in RngEngine.test.cu
+TEST(XorwowTest, device_regression)
+{
+    int           num_samples = 1024;
+    RngStateStore container(num_samples, MemSpace::host);
+    EXPECT_EQ(MemSpace::host, container.memspace());
+
+    std::vector<unsigned int> test_values;
+    for (int i = 0; i < num_samples; i += 127)
+    {
+        RngEngine rng(container.device_pointers(), ThreadId(i));
+        test_values.push_back(rng());
+    }
+
+    static const unsigned int expected_test_values[] = {165860337u,
+                                                        3006138920u,
+                                                        2161337536u,
+                                                        390101068u,
+                                                        2347834113u,
+                                                        100129048u,
+                                                        4122784086u,
+                                                        473544901u,
+                                                        2822849608u};
+    EXPECT_VEC_EQ(expected_test_values, test_values);
+}
+
+TEST(XorwowTest, device_regression_canonical)
+{
+    RngStateStore float_states(2, MemSpace::host);
+    RngStateStore double_states(2, MemSpace::host);
+
+    std::vector<float>  float_values;
+    std::vector<double> double_values;
+    for (auto i : celeritas::range(2))
+    {
+        RngEngine float_rng(float_states.device_pointers(), ThreadId(i));
+        float_values.push_back(generate_canonical<float>(float_rng));
+        RngEngine double_rng(double_states.device_pointers(), ThreadId(i));
+        double_values.push_back(generate_canonical<double>(double_rng));
+    }
+
+    EXPECT_FLOAT_EQ(0.038617369, float_values[0]);
+    EXPECT_FLOAT_EQ(0.411269426, float_values[1]);
+    EXPECT_DOUBLE_EQ(0.283318433931184, double_values[0]);
+    EXPECT_DOUBLE_EQ(0.653335242131673, double_values[1]);
+}
+
+TEST(XorwowTest, offset)
+{
+    const unsigned long long seed = 0x123456789abcdefull;
+
+    RngState expected;
+    celeritas::curand_init(seed, 0, 0, &expected);
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(1000))
+    {
+        celeritas::curand(&expected);
+    }
+
+    RngState actual;
+    celeritas::curand_init(seed, 0, 1000, &actual);
+    EXPECT_VEC_EQ(state_vector(expected), state_vector(actual));
+    EXPECT_EQ(celeritas::curand(&expected), celeritas::curand(&actual));
+
+    // Skip ahead after initialization
+    celeritas::curand_init(seed, 0, 0, &actual);
+    celeritas::skipahead(600, &actual);
+    celeritas::skipahead(400, &actual);
+    celeritas::curand(&actual);
+    EXPECT_VEC_EQ(state_vector(expected), state_vector(actual));
+}
+
+TEST(XorwowTest, subsequence)
+{
+    const unsigned long long seed = 12345;
+
+    // A subsequence is 2^67 = 16 * 2^63 draws
+    RngState expected;
+    celeritas::curand_init(seed, 0, 0, &expected);
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(3 * 16))
+    {
+        celeritas::skipahead(1ull << 63, &expected);
+    }
+    celeritas::skipahead(10, &expected);
+
+    RngState actual;
+    celeritas::curand_init(seed, 3, 10, &actual);
+    EXPECT_VEC_EQ(state_vector(expected), state_vector(actual));
+
+    celeritas::curand_init(seed, 1, 10, &actual);
+    celeritas::skipahead_sequence(2, &actual);
+    EXPECT_VEC_EQ(state_vector(expected), state_vector(actual));
+
+    // Different subsequences give different streams
+    RngState other;
+    celeritas::curand_init(seed, 4, 10, &other);
+    EXPECT_NE(celeritas::curand(&actual), celeritas::curand(&other));
+}
+
+TEST(XorwowTest, host_engine)
+{
+    int           num_samples = 1024 * 1000;
+    unsigned long seed        = 12345u;
+
+    RngState         host_state[1];
+    RngStatePointers host_pointers{celeritas::make_span(host_state)};
+    RngEngine        rng(host_pointers, ThreadId{0});
+    rng = RngEngine::Initializer_t{seed};
+
+    double mean = 0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        double x = generate_canonical<double>(rng);
+        EXPECT_LT(0, x);
+        EXPECT_GE(1, x);
+        mean += x;
+    }
+    mean /= num_samples;
+    EXPECT_NEAR(0.5, mean, 0.001);
+}
@@ -7,12 +7,16 @@
 //---------------------------------------------------------------------------//
 #include "random/distributions/ExponentialDistribution.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <random>
 #include "base/Range.hh"
 #include "celeritas_test.hh"
 #include "../DiagnosticRngEngine.hh"
 
 using celeritas::ExponentialDistribution;
+using celeritas::SamplingMethod;
 
 //---------------------------------------------------------------------------//
 // TEST HARNESS
@@ -58,3 +62,57 @@ TEST_F(ExponentialDistributionTest, all)
     EXPECT_VEC_EQ(expected_counters, counters);
     EXPECT_EQ(2 * num_samples, rng.count());
 }
+
+TEST_F(ExponentialDistributionTest, ziggurat)
+{
+    int    num_samples = 100000;
+    double lambda      = 0.25;
+    ExponentialDistribution<double, SamplingMethod::ziggurat> sample(lambda);
+
+    // Bin edges include the tail of the Ziggurat (r / lambda ~ 30.8)
+    const double     edges[] = {1, 2, 4, 8, 16, 32};
+    std::vector<int> counters(std::end(edges) - std::begin(edges) + 1);
+    double           mean = 0;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        double x = sample(rng);
+        ASSERT_GE(x, 0.0);
+        mean += x;
+        auto bin = std::upper_bound(std::begin(edges), std::end(edges), x)
+                   - std::begin(edges);
+        ++counters[bin];
+    }
+    EXPECT_SOFT_NEAR(1 / lambda, mean / num_samples, 0.01);
+
+    // Compare to the exact probability of each bin
+    double prev_cdf = 0;
+    for (auto i : celeritas::range(counters.size()))
+    {
+        double cdf = i < counters.size() - 1
+                         ? 1 - std::exp(-lambda * edges[i])
+                         : 1;
+        double expected = num_samples * (cdf - prev_cdf);
+        EXPECT_NEAR(expected, counters[i], 4 * std::sqrt(expected) + 1)
+            << "in bin " << i;
+        prev_cdf = cdf;
+    }
+
+    // Almost all samples use a single 53-bit draw
+    EXPECT_LT(rng.count(), 2.1 * num_samples);
+}
+
+TEST_F(ExponentialDistributionTest, ziggurat_float)
+{
+    int num_samples = 10000;
+    ExponentialDistribution<float, SamplingMethod::ziggurat> sample_zig(2.0f);
+    ExponentialDistribution<float>                           sample_inv(2.0f);
+
+    double zig_mean = 0;
+    double inv_mean = 0;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        zig_mean += sample_zig(rng);
+        inv_mean += sample_inv(rng);
+    }
+    EXPECT_SOFT_NEAR(inv_mean / num_samples, zig_mean / num_samples, 0.05);
+}
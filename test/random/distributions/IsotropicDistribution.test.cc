@@ -9,11 +9,13 @@
 
 #include <random>
 #include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
 #include "base/Range.hh"
 #include "celeritas_test.hh"
 #include "../DiagnosticRngEngine.hh"
 
 using celeritas::IsotropicDistribution;
+using celeritas::SamplingMethod;
 
 //---------------------------------------------------------------------------//
 // TEST HARNESS
@@ -61,3 +63,32 @@ TEST_F(IsotropicDistributionTest, bin)
     // 2 32-bit samples per double, 2 doubles per sample
     EXPECT_EQ(num_samples * 4, rng.count());
 }
+
+TEST_F(IsotropicDistributionTest, rejection)
+{
+    int num_samples = 10000;
+
+    IsotropicDistribution<double, SamplingMethod::rejection> sample_isotropic;
+
+    std::vector<int> octant_tally(8, 0);
+    double           avg_costheta = 0;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        auto u = sample_isotropic(rng);
+        ASSERT_TRUE(
+            celeritas::is_soft_unit_vector(u, celeritas::SoftEqual<>{}));
+        ++octant_tally[1 * (u[0] >= 0) + 2 * (u[1] >= 0) + 4 * (u[2] >= 0)];
+        avg_costheta += u[2];
+    }
+
+    for (int count : octant_tally)
+    {
+        double octant = static_cast<double>(count) / num_samples;
+        EXPECT_SOFT_NEAR(octant, 1. / 8, 0.1);
+    }
+    EXPECT_NEAR(0, avg_costheta / num_samples, 0.02);
+    // 4 32-bit samples per accepted pair, accepted with probability pi/4
+    EXPECT_SOFT_NEAR(16 / celeritas::constants::pi,
+                     double(rng.count()) / num_samples,
+                     0.02);
+}
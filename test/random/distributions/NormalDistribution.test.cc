@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NormalDistribution.test.cc
+//---------------------------------------------------------------------------//
+#include "random/distributions/NormalDistribution.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <random>
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+#include "../DiagnosticRngEngine.hh"
+
+using celeritas::NormalDistribution;
+using celeritas::SamplingMethod;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+template<class Distribution>
+class NormalDistributionTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override {}
+
+    celeritas_test::DiagnosticRngEngine<std::mt19937> rng;
+};
+
+using Distributions
+    = ::testing::Types<NormalDistribution<double, SamplingMethod::direct>,
+                       NormalDistribution<double, SamplingMethod::ziggurat>,
+                       NormalDistribution<float, SamplingMethod::ziggurat>>;
+TYPED_TEST_SUITE(NormalDistributionTest, Distributions, );
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TYPED_TEST(NormalDistributionTest, moments)
+{
+    int       num_samples = 100000;
+    TypeParam sample(1.5, 0.5);
+    EXPECT_EQ(1.5, sample.mean());
+    EXPECT_EQ(0.5, sample.stddev());
+
+    double sum    = 0;
+    double sum_sq = 0;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        double x = sample(this->rng);
+        sum += x;
+        sum_sq += x * x;
+    }
+    double mean     = sum / num_samples;
+    double variance = sum_sq / num_samples - mean * mean;
+    EXPECT_NEAR(1.5, mean, 0.01);
+    EXPECT_NEAR(0.25, variance, 0.01);
+}
+
+TYPED_TEST(NormalDistributionTest, bins)
+{
+    int       num_samples = 100000;
+    TypeParam sample;
+
+    // Outer bins include the tails of the Ziggurat (r ~ 3.65)
+    const double     edges[] = {-3.5, -2, -1, -0.25, 0, 0.25, 1, 2, 3.5};
+    std::vector<int> counters(std::end(edges) - std::begin(edges) + 1);
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        double x   = sample(this->rng);
+        auto   bin = std::upper_bound(std::begin(edges), std::end(edges), x)
+                   - std::begin(edges);
+        ++counters[bin];
+    }
+
+    // Compare to the exact probability of each bin
+    double prev_cdf = 0;
+    for (auto i : celeritas::range(counters.size()))
+    {
+        double cdf      = i < counters.size() - 1
+                              ? 0.5 * std::erfc(-edges[i] / std::sqrt(2.0))
+                              : 1;
+        double expected = num_samples * (cdf - prev_cdf);
+        EXPECT_NEAR(expected, counters[i], 4 * std::sqrt(expected) + 1)
+            << "in bin " << i;
+        prev_cdf = cdf;
+    }
+}
@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UniformAzimuthDistribution.test.cc
+//---------------------------------------------------------------------------//
+#include "random/distributions/UniformAzimuthDistribution.hh"
+
+#include <cmath>
+#include <random>
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+#include "../DiagnosticRngEngine.hh"
+
+using celeritas::SamplingMethod;
+using celeritas::UniformAzimuthDistribution;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class UniformAzimuthDistributionTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override {}
+
+    //! Tally the sampled angles into equal bins of phi
+    template<class Distribution>
+    std::vector<int> bin_phi(Distribution& sample_azimuth, int num_samples)
+    {
+        std::vector<int> tally(8, 0);
+        for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+        {
+            auto cos_sin = sample_azimuth(rng);
+            EXPECT_SOFT_EQ(1.0,
+                           cos_sin[0] * cos_sin[0] + cos_sin[1] * cos_sin[1]);
+
+            double phi = std::atan2(cos_sin[1], cos_sin[0]);
+            if (phi < 0)
+            {
+                phi += 2 * celeritas::constants::pi;
+            }
+            int bin = static_cast<int>(phi / (2 * celeritas::constants::pi)
+                                       * tally.size());
+            ++tally[std::min<int>(bin, tally.size() - 1)];
+        }
+        return tally;
+    }
+
+    celeritas_test::DiagnosticRngEngine<std::mt19937> rng;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(UniformAzimuthDistributionTest, direct)
+{
+    int num_samples = 10000;
+
+    UniformAzimuthDistribution<> sample_azimuth;
+    for (int count : this->bin_phi(sample_azimuth, num_samples))
+    {
+        EXPECT_SOFT_NEAR(1. / 8, double(count) / num_samples, 0.1);
+    }
+    // 2 32-bit samples per double
+    EXPECT_EQ(2 * num_samples, rng.count());
+}
+
+TEST_F(UniformAzimuthDistributionTest, rejection)
+{
+    int num_samples = 10000;
+
+    UniformAzimuthDistribution<double, SamplingMethod::rejection> sample_azimuth;
+    for (int count : this->bin_phi(sample_azimuth, num_samples))
+    {
+        EXPECT_SOFT_NEAR(1. / 8, double(count) / num_samples, 0.1);
+    }
+    // 4 32-bit samples per trial, accepted with probability pi/4
+    EXPECT_SOFT_NEAR(16 / celeritas::constants::pi,
+                     double(rng.count()) / num_samples,
+                     0.02);
+}
+
+TEST_F(UniformAzimuthDistributionTest, rejection_float)
+{
+    int num_samples = 10000;
+
+    UniformAzimuthDistribution<float, SamplingMethod::rejection> sample_azimuth;
+    for (int count : this->bin_phi(sample_azimuth, num_samples))
+    {
+        EXPECT_SOFT_NEAR(1. / 8, double(count) / num_samples, 0.1);
+    }
+}
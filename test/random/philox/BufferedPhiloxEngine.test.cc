@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BufferedPhiloxEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "random/philox/BufferedPhiloxEngine.hh"
+
+#include <vector>
+#include "base/Range.hh"
+#include "random/distributions/ExponentialDistribution.hh"
+#include "random/distributions/IsotropicDistribution.hh"
+#include "random/philox/PhiloxEngine.hh"
+#include "celeritas_test.hh"
+
+using celeritas::BufferedPhiloxEngine;
+using celeritas::EventId;
+using celeritas::generate_canonical;
+using celeritas::make_span;
+using celeritas::PhiloxEngine;
+using celeritas::TrackId;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BufferedPhiloxEngineTest : public celeritas::Test
+{
+  protected:
+    celeritas::PhiloxKey key = celeritas::make_philox_key(0xfeedbeef12345ull);
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(BufferedPhiloxEngineTest, same_stream)
+{
+    PhiloxEngine            expected(key, EventId{1}, TrackId{3}, 7);
+    BufferedPhiloxEngine<8> actual(key, EventId{1}, TrackId{3}, 7);
+
+    // Cross several buffer refills and batch widths
+    for (CELER_MAYBE_UNUSED auto i : celeritas::range(1000))
+    {
+        ASSERT_EQ(expected(), actual());
+    }
+}
+
+TEST_F(BufferedPhiloxEngineTest, fill_canonical)
+{
+    PhiloxEngine             expected(key, EventId{0}, TrackId{0}, 0);
+    BufferedPhiloxEngine<12> actual(key, EventId{0}, TrackId{0}, 0);
+
+    // Start at an odd position in the buffer so doubles straddle a refill
+    EXPECT_EQ(expected(), actual());
+
+    std::vector<double> doubles(101);
+    actual.fill_canonical(make_span(doubles));
+    for (double d : doubles)
+    {
+        ASSERT_EQ(generate_canonical<double>(expected), d);
+        ASSERT_LE(0.0, d);
+        ASSERT_GT(1.0, d);
+    }
+
+    std::vector<float> floats(99);
+    actual.fill_canonical(make_span(floats));
+    for (float f : floats)
+    {
+        ASSERT_EQ(generate_canonical<float>(expected), f);
+    }
+
+    EXPECT_EQ(generate_canonical<double>(expected),
+              generate_canonical<double>(actual));
+}
+
+TEST_F(BufferedPhiloxEngineTest, distributions)
+{
+    PhiloxEngine          expected(key, EventId{2}, TrackId{5}, 1);
+    BufferedPhiloxEngine<> actual(key, EventId{2}, TrackId{5}, 1);
+
+    celeritas::ExponentialDistribution<> sample_exp(2.0);
+    celeritas::IsotropicDistribution<>   sample_iso;
+    for (CELER_MAYBE_UNUSED auto i : celeritas::range(100))
+    {
+        EXPECT_EQ(sample_exp(expected), sample_exp(actual));
+        auto dir_expected = sample_iso(expected);
+        auto dir_actual   = sample_iso(actual);
+        EXPECT_EQ(dir_expected[0], dir_actual[0]);
+        EXPECT_EQ(dir_expected[2], dir_actual[2]);
+    }
+}
@@ -0,0 +1,143 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "random/philox/PhiloxEngine.hh"
+
+#include <vector>
+#include "base/Range.hh"
+#include "random/philox/PhiloxStateStore.hh"
+#include "celeritas_test.hh"
+
+using celeritas::EventId;
+using celeritas::generate_canonical;
+using celeritas::MemSpace;
+using celeritas::PhiloxCounter;
+using celeritas::PhiloxEngine;
+using celeritas::PhiloxKey;
+using celeritas::PhiloxStateStore;
+using celeritas::ThreadId;
+using celeritas::TrackId;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+std::vector<unsigned int> to_vector(const PhiloxCounter& c)
+{
+    return {c[0], c[1], c[2], c[3]};
+}
+
+std::vector<unsigned int> sample(PhiloxEngine rng, int count)
+{
+    std::vector<unsigned int> result;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(count))
+    {
+        result.push_back(rng());
+    }
+    return result;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+// Known-answer vectors from the Random123 distribution
+TEST(PhiloxEngineTest, known_answers)
+{
+    {
+        static const unsigned int expected[]
+            = {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u};
+        EXPECT_VEC_EQ(expected,
+                      to_vector(PhiloxEngine::generate_block({0, 0, 0, 0},
+                                                             {0, 0})));
+    }
+    {
+        static const unsigned int expected[]
+            = {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu};
+        EXPECT_VEC_EQ(expected,
+                      to_vector(PhiloxEngine::generate_block(
+                          {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                          {0xffffffffu, 0xffffffffu})));
+    }
+    {
+        static const unsigned int expected[]
+            = {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u};
+        EXPECT_VEC_EQ(expected,
+                      to_vector(PhiloxEngine::generate_block(
+                          {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                          {0xa4093822u, 0x299f31d0u})));
+    }
+}
+
+TEST(PhiloxEngineTest, stream)
+{
+    PhiloxKey key = celeritas::make_philox_key(12345);
+
+    // Blocks are consecutive counters
+    PhiloxEngine rng(key, EventId{2}, TrackId{7}, 3);
+    auto         values = sample(rng, 8);
+    auto first = PhiloxEngine::generate_block({0, 3, 7, 2}, key);
+    auto second = PhiloxEngine::generate_block({1, 3, 7, 2}, key);
+    EXPECT_EQ(first[0], values[0]);
+    EXPECT_EQ(first[3], values[3]);
+    EXPECT_EQ(second[0], values[4]);
+    EXPECT_EQ(second[3], values[7]);
+
+    // Different step, track, event, or seed give different streams
+    EXPECT_NE(values, sample(PhiloxEngine(key, EventId{2}, TrackId{7}, 4), 8));
+    EXPECT_NE(values, sample(PhiloxEngine(key, EventId{2}, TrackId{8}, 3), 8));
+    EXPECT_NE(values, sample(PhiloxEngine(key, EventId{3}, TrackId{7}, 3), 8));
+    EXPECT_NE(values,
+              sample(PhiloxEngine(celeritas::make_philox_key(12346),
+                                  EventId{2},
+                                  TrackId{7},
+                                  3),
+                     8));
+}
+
+TEST(PhiloxEngineTest, slot_independence)
+{
+    PhiloxStateStore small(4, MemSpace::host);
+    PhiloxStateStore large(100, MemSpace::host);
+    EXPECT_EQ(4, small.size());
+    EXPECT_EQ(MemSpace::host, large.memspace());
+
+    auto small_state = small.device_pointers();
+    auto large_state = large.device_pointers();
+    small_state.step[1] = 5;
+    large_state.step[93] = 5;
+
+    // The same track at the same step in different slots
+    auto expected = sample(
+        PhiloxEngine(small_state, ThreadId{1}, EventId{0}, TrackId{42}), 10);
+    auto actual = sample(
+        PhiloxEngine(large_state, ThreadId{93}, EventId{0}, TrackId{42}), 10);
+    EXPECT_VEC_EQ(expected, actual);
+}
+
+TEST(PhiloxEngineTest, generate_canonical)
+{
+    PhiloxEngine rng(celeritas::make_philox_key(1), EventId{0}, TrackId{0}, 0);
+
+    int    num_samples = 100000;
+    double mean_float  = 0;
+    double mean_double = 0;
+    for (CELER_MAYBE_UNUSED int i : celeritas::range(num_samples))
+    {
+        float f = generate_canonical<float>(rng);
+        EXPECT_LE(0, f);
+        EXPECT_GT(1, f);
+        mean_float += f;
+
+        double d = generate_canonical<double>(rng);
+        EXPECT_LE(0, d);
+        EXPECT_GT(1, d);
+        mean_double += d;
+    }
+    EXPECT_NEAR(0.5, mean_float / num_samples, 0.005);
+    EXPECT_NEAR(0.5, mean_double / num_samples, 0.005);
+}